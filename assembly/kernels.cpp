@@ -0,0 +1,22 @@
+// kernels.cpp
+//
+// Out-of-line instances of the kernels in kernels.hpp. run_codegen.sh reads
+// the codegen_<group>_<variant> symbols out of this file's assembly and
+// times the codegen_loop_<group>_<variant> loops from main.cpp.
+#include "kernels.hpp"
+
+#define CODEGEN_DEFINE(group, variant)                                         \
+  extern "C" uint32_t codegen_##group##_##variant(                             \
+      uint32_t a, uint32_t b, const codegen::KernelParams *p) {                \
+    return codegen::group##_##variant(a, b, *p);                               \
+  }                                                                            \
+  extern "C" void codegen_loop_##group##_##variant(                            \
+      const uint32_t *a, const uint32_t *b, uint32_t *out, size_t n,           \
+      const codegen::KernelParams *p) {                                        \
+    const codegen::KernelParams params = *p;                                   \
+    for (size_t i = 0; i < n; ++i) {                                           \
+      out[i] = codegen::group##_##variant(a[i], b[i], params);                 \
+    }                                                                          \
+  }
+CODEGEN_KERNELS(CODEGEN_DEFINE)
+#undef CODEGEN_DEFINE
@@ -0,0 +1,178 @@
+// kernels.hpp
+//
+// Variants of the small scalar kernels on the table fields' hot paths, for
+// run_codegen.sh to compile, disassemble and time side by side. Every
+// variant of a group computes the same function on the group's operand
+// domain; the first one listed is the reference the others are checked
+// against.
+//
+// Exponents follow gfb::GF2mZech: nonzero elements are logs in [1, q] with
+// q = 2^m - 1 standing for x^0 = 1, and 0 is the zero element. Lookup
+// kernels take polynomial-basis values instead.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace codegen {
+
+struct KernelParams {
+  uint32_t m;
+  uint32_t q;                // 2^m - 1
+  const uint32_t *log;       // log[x] in [0, q) for x != 0
+  const uint32_t *log_zero;  // log, with log_zero[0] = 2q
+  const uint32_t *exp;       // exp[k] = x^k for k < q
+  const uint32_t *exp2;      // exp over [0, 2q), no reduction needed
+  const uint32_t *exp4;      // exp2 followed by zeros up to 4q
+};
+
+// Operand domains
+enum class Operands {
+  kExponents,   // a, b in [1, q]
+  kLogs,        // a, b in [0, q], zeros included
+  kDivision,    // a in [0, q], b in [1, q]
+  kNonzeroLog,  // a in [1, q]
+  kPolynomials, // a, b in [0, q] as bit vectors, zeros included
+};
+
+//------------------------------------------------------------------------------
+// Exponent reduction: a + b in [2, 2q] back into [1, q]
+//------------------------------------------------------------------------------
+
+inline uint32_t reduce_mod(uint32_t a, uint32_t b, const KernelParams &p) {
+  return (a + b - 1) % p.q + 1;
+}
+
+// The compare-and-subtract form
+inline uint32_t reduce_ternary(uint32_t a, uint32_t b, const KernelParams &p) {
+  uint32_t s = a + b;
+  return s > p.q ? s - p.q : s;
+}
+
+// GF2mZech::ReduceExponent: subtract 2^m, add q back under the sign mask
+inline uint32_t reduce_sign_mask(uint32_t a, uint32_t b, const KernelParams &p) {
+  int32_t v = static_cast<int32_t>(a + b - p.q - 1);
+  return static_cast<uint32_t>(v + static_cast<int32_t>(p.q & (v >> 31))) + 1;
+}
+
+// q is a Mersenne number: s = hi * 2^m + lo = hi + lo (mod q), and for s in
+// [2, 2q] the fold lands in [1, q] without a correction step
+inline uint32_t reduce_mersenne(uint32_t a, uint32_t b, const KernelParams &p) {
+  uint32_t s = a + b;
+  return (s & p.q) + (s >> p.m);
+}
+
+//------------------------------------------------------------------------------
+// Zero handling in the log-domain Mul, Div and Inv
+//------------------------------------------------------------------------------
+
+inline uint32_t mul_branch(uint32_t a, uint32_t b, const KernelParams &p) {
+  if (a == 0 || b == 0) return 0;
+  return reduce_sign_mask(a, b, p);
+}
+
+// GF2mZech::Mul
+inline uint32_t mul_select(uint32_t a, uint32_t b, const KernelParams &p) {
+  uint32_t s = reduce_sign_mask(a, b, p);
+  return (a == 0 || b == 0) ? 0 : s;
+}
+
+inline uint32_t mul_mask(uint32_t a, uint32_t b, const KernelParams &p) {
+  uint32_t s = reduce_sign_mask(a, b, p);
+  return s & (0u - static_cast<uint32_t>((a != 0) & (b != 0)));
+}
+
+inline uint32_t div_branch(uint32_t a, uint32_t b, const KernelParams &p) {
+  if (a == 0) return 0;
+  return a >= b ? a - b + (a == b ? p.q : 0) : a + p.q - b;
+}
+
+// GF2mZech::Div
+inline uint32_t div_select(uint32_t a, uint32_t b, const KernelParams &p) {
+  int32_t v = static_cast<int32_t>(a) - static_cast<int32_t>(b) - 1;
+  uint32_t s = static_cast<uint32_t>(v + static_cast<int32_t>(p.q & (v >> 31))) + 1;
+  return a == 0 ? 0 : s;
+}
+
+inline uint32_t div_mask(uint32_t a, uint32_t b, const KernelParams &p) {
+  int32_t v = static_cast<int32_t>(a) - static_cast<int32_t>(b) - 1;
+  uint32_t s = static_cast<uint32_t>(v + static_cast<int32_t>(p.q & (v >> 31))) + 1;
+  return s & (0u - static_cast<uint32_t>(a != 0));
+}
+
+// GF2mZech::Inv
+inline uint32_t inv_select(uint32_t a, uint32_t, const KernelParams &p) {
+  uint32_t s = p.q - a;
+  return s == 0 ? p.q : s;
+}
+
+inline uint32_t inv_branch(uint32_t a, uint32_t, const KernelParams &p) {
+  if (a == p.q) return p.q;
+  return p.q - a;
+}
+
+inline uint32_t inv_mod(uint32_t a, uint32_t, const KernelParams &p) {
+  return (2 * p.q - a - 1) % p.q + 1;
+}
+
+//------------------------------------------------------------------------------
+// Log/antilog table multiplication (polynomial-basis operands)
+//------------------------------------------------------------------------------
+
+// Reduced exponent, as Givaro and xgalois index their tables
+inline uint32_t lookup_mod(uint32_t a, uint32_t b, const KernelParams &p) {
+  if (a == 0 || b == 0) return 0;
+  return p.exp[(p.log[a] + p.log[b]) % p.q];
+}
+
+// Doubled antilog table: no reduction, zero still tested
+inline uint32_t lookup_doubled(uint32_t a, uint32_t b, const KernelParams &p) {
+  uint32_t r = p.exp2[p.log[a] + p.log[b]];
+  return (a == 0 || b == 0) ? 0 : r;
+}
+
+// log(0) = 2q points every product with zero into the zero tail of exp4:
+// two loads, one add, no test
+inline uint32_t lookup_sentinel(uint32_t a, uint32_t b, const KernelParams &p) {
+  return p.exp4[p.log_zero[a] + p.log_zero[b]];
+}
+
+} // namespace codegen
+
+// X(group, variant), reference variant first in each group
+#define CODEGEN_KERNELS(X)   \
+  X(reduce, mod)             \
+  X(reduce, ternary)         \
+  X(reduce, sign_mask)       \
+  X(reduce, mersenne)        \
+  X(mul, branch)             \
+  X(mul, select)             \
+  X(mul, mask)               \
+  X(div, select)             \
+  X(div, branch)             \
+  X(div, mask)               \
+  X(inv, select)             \
+  X(inv, branch)             \
+  X(inv, mod)                \
+  X(lookup, mod)             \
+  X(lookup, doubled)         \
+  X(lookup, sentinel)
+
+// X(group, operand domain)
+#define CODEGEN_GROUPS(X)                   \
+  X(reduce, codegen::Operands::kExponents)  \
+  X(mul, codegen::Operands::kLogs)          \
+  X(div, codegen::Operands::kDivision)      \
+  X(inv, codegen::Operands::kNonzeroLog)    \
+  X(lookup, codegen::Operands::kPolynomials)
+
+// One exported single-op function per variant, for the disassembly, and
+// one loop over n operand pairs, for the timing
+#define CODEGEN_DECLARE(group, variant)                                        \
+  extern "C" uint32_t codegen_##group##_##variant(                             \
+      uint32_t a, uint32_t b, const codegen::KernelParams *p);                 \
+  extern "C" void codegen_loop_##group##_##variant(                            \
+      const uint32_t *a, const uint32_t *b, uint32_t *out, size_t n,           \
+      const codegen::KernelParams *p);
+CODEGEN_KERNELS(CODEGEN_DECLARE)
+#undef CODEGEN_DECLARE
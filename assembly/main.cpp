@@ -1,28 +1,186 @@
 // main.cpp
-#include <cstdint>
-#include <iostream>
+//
+// Checks and times every kernel variant in kernels.hpp. Each group runs over
+// the same random operands: every variant must match the group's reference
+// variant on all of them (the log/antilog reference is also checked against
+// a carry-less multiply), and is then timed as a loop over the operands.
+// Prints one CSV row per variant for run_codegen.sh:
+//
+//   group,variant,ns_per_op,verified
+//
+// Usage: main [m] [zero_percent]. m defaults to 8. Zero operands are drawn
+// uniformly with everything else unless zero_percent is given; raising it
+// shows what the branchy zero tests cost once they stop predicting.
+#include "kernels.hpp"
 
-// Function 1: Using if-else with assignment
-uint32_t assign_with_if_else(uint32_t &b, uint32_t &c, uint32_t &d) {
-  return (b + c) % d;
+#include <gfb/field/gf2m_modulus.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const size_t kOperands = 1 << 14;
+const int kSamples = 7;
+const double kSampleSeconds = 0.02;
+
+using LoopFn = void (*)(const uint32_t *, const uint32_t *, uint32_t *, size_t,
+                        const codegen::KernelParams *);
+
+struct Kernel {
+  const char *group;
+  const char *variant;
+  LoopFn loop;
+};
+
+const Kernel kKernels[] = {
+#define CODEGEN_ENTRY(group, variant) {#group, #variant, codegen_loop_##group##_##variant},
+    CODEGEN_KERNELS(CODEGEN_ENTRY)
+#undef CODEGEN_ENTRY
+};
+
+struct Group {
+  const char *name;
+  codegen::Operands operands;
+};
+
+const Group kGroups[] = {
+#define CODEGEN_ENTRY(group, operands) {#group, operands},
+    CODEGEN_GROUPS(CODEGEN_ENTRY)
+#undef CODEGEN_ENTRY
+};
+
+struct Tables {
+  std::vector<uint32_t> log, log_zero, exp, exp2, exp4;
+};
+
+Tables BuildTables(uint32_t m, uint64_t poly) {
+  const uint32_t q = (1u << m) - 1;
+  Tables t;
+  t.log.assign(q + 1, 0);
+  t.exp.assign(q, 0);
+  uint32_t x = 1;
+  for (uint32_t k = 0; k < q; ++k) {
+    t.exp[k] = x;
+    t.log[x] = k;
+    x <<= 1;
+    if (x >> m) x ^= static_cast<uint32_t>(poly);
+  }
+  t.log_zero = t.log;
+  t.log_zero[0] = 2 * q;
+  t.exp2.resize(2 * q);
+  for (uint32_t k = 0; k < 2 * q; ++k) t.exp2[k] = t.exp[k % q];
+  t.exp4 = t.exp2;
+  t.exp4.resize(4 * q + 1, 0);
+  return t;
+}
+
+uint32_t PolyMulMod(uint32_t a, uint32_t b, uint32_t m, uint64_t poly) {
+  uint64_t r = 0;
+  for (uint32_t i = 0; i < m; ++i) {
+    if ((b >> i) & 1) r ^= uint64_t{a} << i;
+  }
+  for (uint32_t i = 2 * m - 2; i >= m; --i) {
+    if ((r >> i) & 1) r ^= poly << (i - m);
+  }
+  return static_cast<uint32_t>(r);
+}
+
+// Operands for one domain; a value in [0, q] is zero with probability
+// zero_percent / 100 if given, else uniformly like any other value
+void GenerateOperands(codegen::Operands domain, uint32_t q, int zero_percent,
+                      std::vector<uint32_t> &a, std::vector<uint32_t> &b) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint32_t> nonzero(1, q);
+  std::uniform_int_distribution<uint32_t> any(0, q);
+  std::uniform_int_distribution<int> percent(0, 99);
+  auto maybe_zero = [&] {
+    if (zero_percent < 0) return any(gen);
+    return percent(gen) < zero_percent ? 0u : nonzero(gen);
+  };
+  const bool a_zero = domain != codegen::Operands::kExponents &&
+                      domain != codegen::Operands::kNonzeroLog;
+  const bool b_zero = domain == codegen::Operands::kLogs ||
+                      domain == codegen::Operands::kPolynomials;
+  for (size_t i = 0; i < a.size(); ++i) {
+    a[i] = a_zero ? maybe_zero() : nonzero(gen);
+    b[i] = b_zero ? maybe_zero() : nonzero(gen);
+  }
 }
 
-// Function 2: Using ternary operator with assignment
-uint32_t assign_with_ternary(uint32_t &b, uint32_t &c, uint32_t &d) {
-  return (b + c) > d ? (b + c - d) : (b + c);
+// Best of kSamples, each at least kSampleSeconds of back-to-back loops
+double TimeLoop(LoopFn loop, const std::vector<uint32_t> &a,
+                const std::vector<uint32_t> &b, std::vector<uint32_t> &out,
+                const codegen::KernelParams &params) {
+  using Clock = std::chrono::steady_clock;
+  double best = 1e30;
+  for (int sample = 0; sample < kSamples; ++sample) {
+    size_t ops = 0;
+    auto start = Clock::now();
+    std::chrono::duration<double> elapsed{0};
+    while (elapsed.count() < kSampleSeconds) {
+      loop(a.data(), b.data(), out.data(), a.size(), &params);
+      ops += a.size();
+      elapsed = Clock::now() - start;
+    }
+    best = std::min(best, elapsed.count() * 1e9 / static_cast<double>(ops));
+  }
+  return best;
 }
 
-// Main function to call them (we won't optimize this part for assembly
-// comparison)
-int main() {
-  uint32_t volatile a_val0 = 0;
-  uint32_t volatile a_val1 = 0;
-  uint32_t b_val = 5;
-  uint32_t c_val = 3;
-  uint32_t d_val = 11;
+} // namespace
 
-  a_val0 = assign_with_if_else(b_val, c_val, d_val);
-  a_val1 = assign_with_ternary(b_val, c_val, d_val);
+int main(int argc, char **argv) {
+  const uint32_t m = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 8;
+  const int zero_percent = argc > 2 ? std::atoi(argv[2]) : -1;
+  if (m < 2 || m > 16 || zero_percent > 100) {
+    std::fprintf(stderr, "usage: %s [m in 2..16] [zero_percent in 0..100]\n", argv[0]);
+    return 2;
+  }
 
-  return 0;
-}
\ No newline at end of file
+  const uint64_t poly = gfb::FindPrimitiveModulus(static_cast<uint8_t>(m));
+  const Tables tables = BuildTables(m, poly);
+  const codegen::KernelParams params{m,
+                                     (1u << m) - 1,
+                                     tables.log.data(),
+                                     tables.log_zero.data(),
+                                     tables.exp.data(),
+                                     tables.exp2.data(),
+                                     tables.exp4.data()};
+
+  std::vector<uint32_t> a(kOperands), b(kOperands), out(kOperands), expected;
+  bool all_verified = true;
+
+  std::printf("group,variant,ns_per_op,verified\n");
+  for (const Group &group : kGroups) {
+    GenerateOperands(group.operands, params.q, zero_percent, a, b);
+    expected.clear();
+    for (const Kernel &kernel : kKernels) {
+      if (std::string(kernel.group) != group.name) continue;
+      kernel.loop(a.data(), b.data(), out.data(), kOperands, &params);
+      bool verified = true;
+      if (expected.empty()) {
+        // The reference variant
+        expected = out;
+        if (group.operands == codegen::Operands::kPolynomials) {
+          for (size_t i = 0; i < kOperands; ++i) {
+            verified &= out[i] == PolyMulMod(a[i], b[i], m, poly);
+          }
+        }
+      } else {
+        verified = out == expected;
+      }
+      all_verified &= verified;
+      double ns = TimeLoop(kernel.loop, a, b, out, params);
+      std::printf("%s,%s,%.3f,%s\n", kernel.group, kernel.variant, ns,
+                  verified ? "yes" : "NO");
+    }
+  }
+
+  return all_verified ? 0 : 1;
+}
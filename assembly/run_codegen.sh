@@ -0,0 +1,166 @@
+#!/bin/bash
+
+# Hot-kernel codegen inspection
+# Compiles every kernel variant in kernels.hpp, reads its instruction count,
+# divides, conditional branches and conditional selects out of the
+# assembly, times it with main.cpp, and writes the lot as a Markdown report
+
+set -e
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+NC='\033[0m' # No Color
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+REPO_ROOT="$(cd "$SCRIPT_DIR/.." && pwd)"
+
+# Default values
+CXX="${CXX:-/usr/bin/clang++}"
+FIELD_DEGREE=8
+ZERO_PERCENT=""
+RESULTS_DIR="$SCRIPT_DIR/results"
+
+# Function to print usage
+print_usage() {
+    echo -e "${GREEN}Hot-Kernel Codegen Inspection${NC}"
+    echo ""
+    echo "Usage: $0 [OPTIONS]"
+    echo ""
+    echo -e "${YELLOW}OPTIONS:${NC}"
+    echo "  -m, --degree M        Field degree for the tables and operands, 2..16 (default: 8)"
+    echo "  -z, --zeros PERCENT   Percentage of zero operands (default: uniform draws)"
+    echo "  -o, --output DIR      Output directory (default: $RESULTS_DIR)"
+    echo "  -h, --help            Show this help message"
+    echo ""
+    echo "The compiler is \$CXX (default: /usr/bin/clang++)."
+}
+
+# Parse command line arguments
+while [[ $# -gt 0 ]]; do
+    case $1 in
+        -m|--degree)
+            FIELD_DEGREE="$2"
+            shift 2
+            ;;
+        -z|--zeros)
+            ZERO_PERCENT="$2"
+            shift 2
+            ;;
+        -o|--output)
+            RESULTS_DIR="$2"
+            shift 2
+            ;;
+        -h|--help)
+            print_usage
+            exit 0
+            ;;
+        *)
+            echo -e "${RED}Unknown option: $1${NC}"
+            print_usage
+            exit 1
+            ;;
+    esac
+done
+
+mkdir -p "$RESULTS_DIR"
+TIMESTAMP=$(date +"%Y%m%d_%H%M%S")
+ASM_FILE="$RESULTS_DIR/kernels_${TIMESTAMP}.s"
+STATS_FILE="$RESULTS_DIR/kernels_${TIMESTAMP}_asm.csv"
+TIMES_FILE="$RESULTS_DIR/kernels_${TIMESTAMP}_times.csv"
+REPORT_FILE="$RESULTS_DIR/codegen_report_${TIMESTAMP}.md"
+BINARY="$SCRIPT_DIR/codegen_bench"
+
+# The timed loops stay scalar: on the real hot paths these kernels sit
+# between table lookups, and a vectorized loop would measure something else
+if "$CXX" --version 2>/dev/null | grep -q clang; then
+    NO_VECTORIZE="-fno-vectorize -fno-slp-vectorize"
+else
+    NO_VECTORIZE="-fno-tree-vectorize"
+fi
+CXX_FLAGS="-std=c++23 -O3 -DNDEBUG"
+
+echo -e "${YELLOW}Compiling kernels to assembly...${NC}"
+"$CXX" $CXX_FLAGS -S "$SCRIPT_DIR/kernels.cpp" -o "$ASM_FILE"
+
+# One row per single-op symbol codegen_<group>_<variant>; Mach-O prefixes
+# symbols with an underscore
+awk '
+    BEGIN { print "kernel,instructions,divides,branches,selects" }
+    /^_?codegen_[a-z_]+:/ {
+        name = $0
+        sub(/:.*/, "", name)
+        sub(/^_/, "", name)
+        if (name ~ /^codegen_loop_/) name = ""
+        insns = divs = branches = selects = 0
+        next
+    }
+    name != "" && /\.cfi_endproc/ {
+        printf "%s,%d,%d,%d,%d\n", name, insns, divs, branches, selects
+        name = ""
+        next
+    }
+    name != "" && /^[ \t]+[a-z]/ {
+        op = $1
+        insns++
+        if (op ~ /^(div|idiv|udiv|sdiv)/) divs++
+        if ((op ~ /^j/ && op !~ /^jmp/) || op ~ /^b\./ || op ~ /^(cbz|cbnz|tbz|tbnz)$/) branches++
+        if (op ~ /^cmov/ || op ~ /^(csel|csinc|csinv|csneg|cset|csetm|cinc)$/) selects++
+    }
+' "$ASM_FILE" > "$STATS_FILE"
+
+echo -e "${YELLOW}Building timing harness...${NC}"
+"$CXX" $CXX_FLAGS $NO_VECTORIZE -I"$REPO_ROOT" \
+    "$SCRIPT_DIR/kernels.cpp" "$SCRIPT_DIR/main.cpp" -o "$BINARY"
+
+echo -e "${YELLOW}Timing kernels (m = $FIELD_DEGREE)...${NC}"
+set +e
+"$BINARY" "$FIELD_DEGREE" $ZERO_PERCENT > "$TIMES_FILE"
+VERIFY_STATUS=$?
+set -e
+
+{
+    echo "# Kernel Codegen Report"
+    echo ""
+    echo "- Date: $(date)"
+    echo "- Compiler: $("$CXX" --version | head -n1)"
+    echo "- Flags: \`$CXX_FLAGS\` (timing harness adds \`$NO_VECTORIZE\`)"
+    echo "- Architecture: $(uname -m)"
+    echo "- Field degree: $FIELD_DEGREE"
+    echo "- Zero operands: ${ZERO_PERCENT:+$ZERO_PERCENT%}${ZERO_PERCENT:-uniform}"
+    echo ""
+    echo "Instruction counts are for the single-op function, including the"
+    echo "return and parameter loads. ns/op is the best of several timed loops"
+    echo "over the same operands; the fastest variant of each group is in bold."
+    awk -F, '
+        FNR == 1 { next }
+        NR == FNR { asm[$1] = $2 " | " $3 " | " $4 " | " $5; next }
+        {
+            group = $1
+            if (!(group in best) || $3 + 0 < best[group] + 0) best[group] = $3
+            rows[++n] = $0
+        }
+        END {
+            for (i = 1; i <= n; ++i) {
+                split(rows[i], f, ",")
+                if (f[1] != current) {
+                    current = f[1]
+                    printf "\n## %s\n\n", current
+                    print "| Variant | Instructions | Divides | Branches | Selects | ns/op | Verified |"
+                    print "|---|---:|---:|---:|---:|---:|---|"
+                }
+                ns = f[3] == best[f[1]] ? "**" f[3] "**" : f[3]
+                printf "| %s | %s | %s | %s |\n", f[2], asm["codegen_" f[1] "_" f[2]], ns, f[4]
+            }
+        }
+    ' "$STATS_FILE" "$TIMES_FILE"
+} > "$REPORT_FILE"
+
+cat "$REPORT_FILE"
+echo ""
+if [ $VERIFY_STATUS -ne 0 ]; then
+    echo -e "${RED}Some variants disagree with their reference (see Verified)${NC}"
+    exit 1
+fi
+echo -e "${GREEN}Report saved to: $REPORT_FILE${NC}"
@@ -1,23 +1,68 @@
 /**
  * @file binary_extension_benchmark.cpp
- * @brief Performance comparison between Givaro GFq and xgalois GF2X
- * Benchmarks GF(2^m) operations for both implementations
+ * @brief Performance comparison between Givaro GFq, xgalois GF2X, NTL GF2E
+ * and the in-tree gfb engines (Zech-log, log/antilog, split-table regions,
+ * CLMUL, bitsliced batches, GF(2^8) towers, Gaussian normal bases, trace
+ * and quadratic-solver kernels)
+ * Benchmarks GF(2^m) operations for all implementations
  */
 
+#include <algorithm>
+#include <array>
 #include <benchmark/benchmark.h>
+#include <bit>
+#include <cerrno>
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
 #include <random>
 #include <stdexcept>
+#include <string>
 #include <sys/resource.h>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <unistd.h>
 #include <vector>
 
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
 #include <givaro/gfq.h>
 #include <xgalois/field/gf_binary.hpp>
 #include <NTL/GF2X.h>
 #include <NTL/GF2E.h>
 
+#include <gfb/code/reed_solomon.hpp>
+#include <gfb/field/batch_arith.hpp>
+#include <gfb/field/gf2m_basis_map.hpp>
+#include <gfb/field/gf2m_bitslice.hpp>
+#include <gfb/field/gf2m_clmul.hpp>
+#include <gfb/field/gf2m_log.hpp>
+#include <gfb/field/gf2m_modulus.hpp>
+#include <gfb/field/gf2m_normal.hpp>
+#include <gfb/field/gf2m_pow.hpp>
+#include <gfb/field/gf2m_region.hpp>
+#include <gfb/field/gf2m_table_cache.hpp>
+#include <gfb/field/gf2m_tower.hpp>
+#include <gfb/field/gf2m_trace.hpp>
+#include <gfb/field/gf2m_zech.hpp>
+#include <gfb/linalg/matrix_arith.hpp>
+#include <gfb/perf/operand_corpus.hpp>
+#include <gfb/perf/perf_counters.hpp>
+#include <gfb/poly/poly_arith.hpp>
+
 //------------------------------------------------------------------------------
 // Memory Usage Utilities
 //------------------------------------------------------------------------------
@@ -26,526 +71,3536 @@ struct MemoryUsage {
   size_t peak_rss_kb;
   size_t current_rss_kb;
 
-  MemoryUsage() : peak_rss_kb(0), current_rss_kb(0) {}
-};
+  MemoryUsage() : peak_rss_kb(0), current_rss_kb(0) {}
+};
+
+// Process-wide RSS without allocating, so it is safe inside an
+// AllocationScope: /proc/self/statm on Linux, task_info on macOS
+MemoryUsage GetMemoryUsage() {
+  MemoryUsage usage;
+
+  // ru_maxrss is in kilobytes on Linux and in bytes on macOS
+  struct rusage rusage_data;
+  if (getrusage(RUSAGE_SELF, &rusage_data) == 0) {
+#if defined(__APPLE__)
+    usage.peak_rss_kb = rusage_data.ru_maxrss / 1024;
+#else
+    usage.peak_rss_kb = rusage_data.ru_maxrss;
+#endif
+  }
+
+#if defined(__linux__)
+  // statm: size resident shared text lib data dt, in pages
+  int fd = open("/proc/self/statm", O_RDONLY);
+  if (fd >= 0) {
+    char buffer[128];
+    ssize_t bytes = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (bytes > 0) {
+      buffer[bytes] = '\0';
+      unsigned long size_pages = 0, resident_pages = 0;
+      if (sscanf(buffer, "%lu %lu", &size_pages, &resident_pages) == 2) {
+        usage.current_rss_kb = resident_pages * (sysconf(_SC_PAGESIZE) / 1024);
+      }
+    }
+  }
+#elif defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+    usage.current_rss_kb = info.resident_size / 1024;
+  }
+#endif
+
+  return usage;
+}
+
+//------------------------------------------------------------------------------
+// Allocation Tracking
+//------------------------------------------------------------------------------
+//
+// Heap blocks are charged to the innermost AllocationScope open on the
+// allocating thread. With glibc the malloc family itself is interposed and
+// forwarded to __libc_malloc and friends, so C allocations (NTL's GF2X
+// storage) are counted along with operator new, which goes through malloc.
+// Elsewhere the global operator new/delete are replaced instead. Blocks are
+// charged at their usable size, which is what the process actually pays.
+// Sanitizer builds keep their own allocator and report zero heap bytes.
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#elif defined(__GLIBC__)
+#define GFB_HOOK_MALLOC 1
+#else
+#define GFB_HOOK_OPERATOR_NEW 1
+#endif
+
+struct AllocationCounts {
+  int64_t live_bytes = 0; // Allocated minus freed while the scope was open
+  int64_t peak_bytes = 0;
+  uint64_t allocations = 0;
+};
+
+// Constant-initialized, so the allocator hooks may read it at any time
+thread_local AllocationCounts *t_allocation_counts = nullptr;
+
+inline size_t AllocatedBlockSize(void *p) {
+#if defined(__APPLE__)
+  return malloc_size(p);
+#else
+  return malloc_usable_size(p);
+#endif
+}
+
+inline void RecordAllocation(void *p) {
+  AllocationCounts *counts = t_allocation_counts;
+  if (!counts || !p) return;
+  counts->live_bytes += static_cast<int64_t>(AllocatedBlockSize(p));
+  counts->peak_bytes = std::max(counts->peak_bytes, counts->live_bytes);
+  counts->allocations++;
+}
+
+inline void RecordFree(void *p) {
+  AllocationCounts *counts = t_allocation_counts;
+  if (!counts || !p) return;
+  counts->live_bytes -= static_cast<int64_t>(AllocatedBlockSize(p));
+}
+
+#if defined(GFB_HOOK_MALLOC)
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *p);
+
+void *malloc(size_t size) {
+  void *p = __libc_malloc(size);
+  RecordAllocation(p);
+  return p;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *p = __libc_calloc(count, size);
+  RecordAllocation(p);
+  return p;
+}
+
+void *realloc(void *p, size_t size) {
+  RecordFree(p);
+  void *q = __libc_realloc(p, size);
+  // A failed realloc leaves p allocated; a zero-size one frees it
+  RecordAllocation(q ? q : (size ? p : nullptr));
+  return q;
+}
+
+void *memalign(size_t alignment, size_t size) {
+  void *p = __libc_memalign(alignment, size);
+  RecordAllocation(p);
+  return p;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+  return memalign(alignment, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+  if (alignment < sizeof(void *) || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  void *p = memalign(alignment, size);
+  if (!p) return ENOMEM;
+  *result = p;
+  return 0;
+}
+
+void *valloc(size_t size) {
+  return memalign(static_cast<size_t>(sysconf(_SC_PAGESIZE)), size);
+}
+
+void free(void *p) {
+  RecordFree(p);
+  __libc_free(p);
+}
+} // extern "C"
+#elif defined(GFB_HOOK_OPERATOR_NEW)
+void *operator new(size_t size) {
+  void *p = std::malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  RecordAllocation(p);
+  return p;
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+  void *p = nullptr;
+  size_t align = std::max(static_cast<size_t>(alignment), sizeof(void *));
+  if (posix_memalign(&p, align, size ? size : 1) != 0) throw std::bad_alloc();
+  RecordAllocation(p);
+  return p;
+}
+
+void operator delete(void *p) noexcept {
+  RecordFree(p);
+  std::free(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+  RecordFree(p);
+  std::free(p);
+}
+#endif
+
+// Charges every heap block allocated or freed on this thread to Counts()
+// until destroyed
+class AllocationScope {
+public:
+  AllocationScope() : previous_(t_allocation_counts) {
+    t_allocation_counts = &counts_;
+  }
+  ~AllocationScope() { t_allocation_counts = previous_; }
+
+  AllocationScope(const AllocationScope &) = delete;
+  AllocationScope &operator=(const AllocationScope &) = delete;
+
+  const AllocationCounts &Counts() const { return counts_; }
+
+private:
+  AllocationCounts counts_;
+  AllocationCounts *previous_;
+};
+
+// What one field instance holds once constructed
+struct FieldFootprint {
+  int64_t heap_bytes = 0;      // Live heap bytes, including the object itself
+  int64_t peak_heap_bytes = 0; // Including construction scratch
+  uint64_t allocations = 0;
+  int64_t rss_delta_kb = 0;    // Resident growth, page granular
+};
+
+// Builds one extra instance with make(), which returns it by unique_ptr, and
+// measures it before it is destroyed
+template <typename Factory> FieldFootprint MeasureFieldFootprint(Factory make) {
+  FieldFootprint footprint;
+  size_t rss_before = GetMemoryUsage().current_rss_kb;
+  AllocationScope scope;
+  auto field = make();
+  footprint.heap_bytes = scope.Counts().live_bytes;
+  footprint.peak_heap_bytes = scope.Counts().peak_bytes;
+  footprint.allocations = scope.Counts().allocations;
+  footprint.rss_delta_kb = static_cast<int64_t>(GetMemoryUsage().current_rss_kb) -
+                           static_cast<int64_t>(rss_before);
+  return footprint;
+}
+
+static void SetMemoryCounters(benchmark::State &state,
+                              const FieldFootprint &footprint) {
+  MemoryUsage usage = GetMemoryUsage();
+  state.counters["MemoryPeak_KB"] = usage.peak_rss_kb;
+  state.counters["MemoryCurrent_KB"] = usage.current_rss_kb;
+  state.counters["FieldHeapBytes"] =
+      benchmark::Counter(static_cast<double>(footprint.heap_bytes),
+                         benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["FieldPeakHeapBytes"] =
+      benchmark::Counter(static_cast<double>(footprint.peak_heap_bytes),
+                         benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.counters["FieldAllocations"] = static_cast<double>(footprint.allocations);
+  state.counters["FieldRSSDelta_KB"] = static_cast<double>(footprint.rss_delta_kb);
+}
+
+//------------------------------------------------------------------------------
+// Hardware Counter Utilities
+//------------------------------------------------------------------------------
+//
+// Every benchmark loop is written `for (auto _ : WithPerfCounters(state))`,
+// which counts only the timed iterations: the thread's perf group (see
+// gfb/perf/perf_counters.hpp) is enabled once the first iteration starts and
+// disabled as soon as the loop ends. Event counts are reported per
+// iteration, like the time columns, and IPC as a ratio. Where counters are
+// unavailable they are simply omitted, and the reason is recorded in the
+// JSON context under "hw_counters".
+
+// Opened on first use in each benchmark thread and kept until it exits
+gfb::PerfCounterGroup &ThreadPerfCounters() {
+  thread_local gfb::PerfCounterGroup group;
+  return group;
+}
+
+const bool PERF_COUNTERS_PROBED = [] {
+  const gfb::PerfCounterGroup &group = ThreadPerfCounters();
+  std::string status = group.Available() ? "perf_event_open" : "unavailable";
+  if (!group.Error().empty()) status += " (" + group.Error() + ")";
+  benchmark::AddCustomContext("hw_counters", status);
+  return true;
+}();
+
+static void SetPerfCounters(benchmark::State &state,
+                            const gfb::PerfSample &sample) {
+  for (gfb::PerfEvent event : gfb::ALL_PERF_EVENTS) {
+    if (!sample.Has(event)) continue;
+    state.counters[gfb::PerfEventName(event)] =
+        benchmark::Counter(static_cast<double>(sample.Get(event)),
+                           benchmark::Counter::kAvgIterations);
+  }
+  const uint64_t cycles = sample.Get(gfb::PerfEvent::kCycles);
+  if (sample.Has(gfb::PerfEvent::kInstructions) && cycles > 0) {
+    double ipc = static_cast<double>(sample.Get(gfb::PerfEvent::kInstructions)) /
+                 static_cast<double>(cycles);
+    state.counters["IPC"] = benchmark::Counter(ipc, benchmark::Counter::kAvgThreads);
+  }
+}
+
+// Range adapter over benchmark::State that brackets the timed loop with the
+// thread's perf counters. The only per-iteration cost is the loop-end check
+// the plain state loop already performs.
+class PerfCountedRange {
+public:
+  explicit PerfCountedRange(benchmark::State &state) : state_(state) {}
+
+  class Iterator {
+  public:
+    Iterator(benchmark::State::StateIterator it, PerfCountedRange *range)
+        : it_(it), range_(range) {}
+
+    benchmark::State::StateIterator::Value operator*() const { return *it_; }
+    Iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const {
+      if (it_ != other.it_) return true;
+      range_->Finish(); // The timer has just stopped
+      return false;
+    }
+
+  private:
+    benchmark::State::StateIterator it_;
+    PerfCountedRange *range_;
+  };
+
+  Iterator begin() {
+    benchmark::State::StateIterator it = state_.begin();
+    ThreadPerfCounters().Start();
+    return Iterator(it, this);
+  }
+  Iterator end() { return Iterator(state_.end(), this); }
+
+private:
+  void Finish() {
+    gfb::PerfCounterGroup &group = ThreadPerfCounters();
+    group.Stop();
+    SetPerfCounters(state_, group.Read());
+  }
+
+  benchmark::State &state_;
+};
+
+PerfCountedRange WithPerfCounters(benchmark::State &state) {
+  return PerfCountedRange(state);
+}
+
+//------------------------------------------------------------------------------
+// Field Sizes for Testing
+//------------------------------------------------------------------------------
+
+// Representative degrees for the sweeps (bulk, latency, threads, ...)
+const std::vector<uint8_t> FIELD_DEGREES = {4, 8, 12, 16, 20};
+
+// Highest degree per backend for the per-op benchmarks, which cover every
+// degree from 2: Givaro and xgalois tables, gfb Zech tables (uint32_t
+// entries) and NTL up to the end of the shared modulus list
+const uint8_t TABLE_MAX_DEGREE = 20;
+const uint8_t ZECH_MAX_DEGREE = 24;
+
+// Size tier in benchmark names, as filtered by run_benchmark.sh
+const char *DegreeTier(uint8_t m) {
+  if (m <= 8) return "Small";
+  if (m <= 16) return "Medium";
+  return "Large";
+}
+
+// Registers fn as <name>/<tier>/<m> for every m in `degrees`
+static void RegisterDegrees(const char *name, void (*fn)(benchmark::State &),
+                            const std::vector<uint8_t> &degrees) {
+  for (const char *tier : {"Small", "Medium", "Large"}) {
+    benchmark::internal::Benchmark *family = nullptr;
+    for (uint8_t m : degrees) {
+      if (std::string(DegreeTier(m)) != tier) continue;
+      if (family == nullptr) {
+        family = benchmark::RegisterBenchmark(
+            (std::string(name) + "/" + tier).c_str(), fn);
+        family->Unit(benchmark::kNanosecond);
+      }
+      family->Arg(m);
+    }
+  }
+}
+
+// The degrees of `degrees` up to max_degree
+static std::vector<uint8_t> DegreesUpTo(const std::vector<uint8_t> &degrees,
+                                        uint8_t max_degree) {
+  std::vector<uint8_t> result;
+  for (uint8_t m : degrees) {
+    if (m <= max_degree) result.push_back(m);
+  }
+  return result;
+}
+
+// Registers fn as <name>/<tier>/<m> for every m in [2, max_degree]
+static void RegisterPerDegree(const char *name,
+                              void (*fn)(benchmark::State &),
+                              uint8_t max_degree) {
+  std::vector<uint8_t> degrees;
+  for (uint8_t m = gfb::kMinModulusDegree; m <= max_degree; ++m) degrees.push_back(m);
+  RegisterDegrees(name, fn, degrees);
+}
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+// Operand streams come from the shared corpus (gfb/perf/operand_corpus.hpp):
+// polynomial-basis values drawn once from mt19937(seed), uniform over the
+// nonzero elements, written to disk and mapped by every later run and by the
+// simulations. Each backend converts the same values into its own
+// representation, so all of them see identical operands. A stream is mapped
+// once per process and shared across threads.
+gfb::OperandCorpus GetOperandCorpus(
+    uint8_t m, size_t count, uint32_t seed,
+    gfb::OperandDistribution distribution = gfb::OperandDistribution::kNonzero) {
+  static std::mutex mutex;
+  static std::map<std::tuple<uint8_t, uint32_t, gfb::OperandDistribution>,
+                  gfb::OperandCorpus>
+      corpora;
+  std::lock_guard<std::mutex> lock(mutex);
+  gfb::OperandCorpus &corpus = corpora[{m, seed, distribution}];
+  if (corpus.size() < count) {
+    corpus = gfb::OpenOperandCorpus(gfb::DefaultOperandCorpusDirectory(), m,
+                                    distribution, seed, count);
+  }
+  return corpus;
+}
+
+// Degree of a field given its order 2^m
+uint8_t OrderDegree(uint64_t order) {
+  return static_cast<uint8_t>(std::countr_zero(order));
+}
+
+// NTL::GF2E from a polynomial-basis value, through the byte-string
+// constructor rather than one SetCoeff per bit
+void ConvertNTLElement(NTL::GF2E &r, uint32_t value) {
+  unsigned char bytes[4] = {static_cast<unsigned char>(value),
+                            static_cast<unsigned char>(value >> 8),
+                            static_cast<unsigned char>(value >> 16),
+                            static_cast<unsigned char>(value >> 24)};
+  NTL::GF2X poly;
+  NTL::GF2XFromBytes(poly, bytes, 4);
+  NTL::conv(r, poly);
+}
+
+template <typename ElementType>
+std::vector<typename Givaro::GFq<ElementType>::Element>
+GenerateRandomGivaroElements(const Givaro::GFq<ElementType> &field, size_t count,
+                            uint32_t seed = 42) {
+  gfb::OperandCorpus corpus =
+      GetOperandCorpus(OrderDegree(field.cardinality()), count, seed);
+  std::vector<typename Givaro::GFq<ElementType>::Element> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    field.init(elements[i], corpus[i]);
+  }
+  return elements;
+}
+
+// xgalois elements are the polynomial-basis values themselves
+std::vector<uint32_t> GenerateRandomXgaloisElements(const xg::GF2XZECH &field,
+                                                   size_t count,
+                                                   uint32_t seed = 42) {
+  gfb::OperandCorpus corpus = GetOperandCorpus(OrderDegree(field.Order()), count, seed);
+  return std::vector<uint32_t>(corpus.data(), corpus.data() + count);
+}
+
+std::vector<NTL::GF2E> GenerateRandomNTLElements(size_t count, uint32_t seed = 42) {
+  gfb::OperandCorpus corpus =
+      GetOperandCorpus(static_cast<uint8_t>(NTL::GF2E::degree()), count, seed);
+  std::vector<NTL::GF2E> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    ConvertNTLElement(elements[i], corpus[i]);
+  }
+  return elements;
+}
+
+template <typename IndexT>
+std::vector<IndexT> GenerateRandomZechElements(const gfb::GF2mZech<IndexT> &field,
+                                               size_t count, uint32_t seed = 42) {
+  gfb::OperandCorpus corpus = GetOperandCorpus(field.Degree(), count, seed);
+  std::vector<IndexT> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    elements[i] = field.FromPolynomial(corpus[i]);
+  }
+  return elements;
+}
+
+// The one modulus every backend uses for degree m: the minimal-weight
+// primitive polynomial from gfb/field/gf2m_modulus.hpp (bit i = coefficient
+// of x^i, including x^m). All degrees are searched once, on first use.
+uint64_t GetModulus(uint8_t m) {
+  static const auto moduli = [] {
+    std::array<uint64_t, gfb::kMaxModulusDegree + 1> table{};
+    for (uint8_t d = gfb::kMinModulusDegree; d <= gfb::kMaxModulusDegree; ++d) {
+      table[d] = gfb::FindPrimitiveModulus(d);
+    }
+    return table;
+  }();
+  if (m < gfb::kMinModulusDegree || m > gfb::kMaxModulusDegree) {
+    throw std::invalid_argument("GetModulus: no shared modulus for degree " +
+                                std::to_string(m));
+  }
+  return moduli[m];
+}
+
+// xgalois format, e.g. "x^8 + x^4 + x^3 + x^2 + 1"
+std::string GetIrreduciblePoly(uint8_t m) {
+  return gfb::ModulusToString(GetModulus(m));
+}
+
+NTL::GF2X GetNTLIrreduciblePoly(uint8_t m) {
+  NTL::GF2X poly;
+  for (int i : gfb::ModulusTerms(GetModulus(m))) NTL::SetCoeff(poly, i);
+  return poly;
+}
+
+// Givaro format: coefficients from x^0 to x^m
+std::vector<int> GetGivaroIrreduciblePoly(uint8_t m) {
+  uint64_t modulus = GetModulus(m);
+  std::vector<int> poly(m + 1, 0);
+  for (int i = 0; i <= m; ++i) poly[i] = (modulus >> i) & 1;
+  return poly;
+}
+
+// Bitmask form for the in-tree table engines, which take 32-bit moduli
+// (m <= 24)
+uint32_t GetIrreduciblePolyBits(uint8_t m) {
+  return static_cast<uint32_t>(GetModulus(m));
+}
+
+// Footprint of one field instance of each backend for degree m (see
+// MeasureFieldFootprint). NTL keeps its modulus tables in a GF2EContext.
+FieldFootprint MeasureGivaroFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] {
+    return std::make_unique<Givaro::GFq<int64_t>>(2, m, GetGivaroIrreduciblePoly(m));
+  });
+}
+
+FieldFootprint MeasureXgaloisFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] {
+    return std::make_unique<xg::GF2XZECH>(m, "log", GetIrreduciblePoly(m));
+  });
+}
+
+FieldFootprint MeasureNTLFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] {
+    return std::make_unique<NTL::GF2EContext>(GetNTLIrreduciblePoly(m));
+  });
+}
+
+template <typename IndexT, gfb::ZechLayout Layout = gfb::ZechLayout::kFull>
+FieldFootprint MeasureZechFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] {
+    return std::make_unique<gfb::GF2mZech<IndexT, Layout>>(m, GetIrreduciblePolyBits(m));
+  });
+}
+
+template <typename IndexT, gfb::LogLayout Layout>
+FieldFootprint MeasureLogFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] {
+    return std::make_unique<gfb::GF2mLog<IndexT, Layout>>(m, GetIrreduciblePolyBits(m));
+  });
+}
+
+// A tower field with its map from the shared polynomial basis: GF2mTower16
+// for m = 16, GF2mTower32 for m = 32
+template <typename Tower> struct TowerField {
+  explicit TowerField(uint8_t m) : field(Make(m)), map(field, GetModulus(m)) {}
+
+  static Tower Make(uint8_t m) {
+    if (m != 16 * sizeof(typename Tower::BaseElement)) {
+      throw std::invalid_argument("TowerField: no tower of degree " + std::to_string(m));
+    }
+    if constexpr (std::is_same_v<Tower, gfb::GF2mTower16>) {
+      return gfb::MakeGF2mTower16();
+    } else {
+      return gfb::MakeGF2mTower32();
+    }
+  }
+
+  Tower field;
+  gfb::GF2mBasisMap<Tower> map;
+};
+
+template <typename Tower> FieldFootprint MeasureTowerFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] { return std::make_unique<TowerField<Tower>>(m); });
+}
+
+// A normal-basis field with its map from the shared polynomial basis
+struct NormalField {
+  explicit NormalField(uint8_t m) : field(m), map(field, GetModulus(m)) {}
+
+  gfb::GF2mNormal field;
+  gfb::GF2mBasisMap<gfb::GF2mNormal> map;
+};
+
+FieldFootprint MeasureNormalFootprint(uint8_t m) {
+  return MeasureFieldFootprint([m] { return std::make_unique<NormalField>(m); });
+}
+
+FieldFootprint MeasureClmulFootprint(uint8_t m, uint64_t low) {
+  return MeasureFieldFootprint([m, low] {
+    return std::make_unique<gfb::GF2mClmul>(m, low);
+  });
+}
+
+//------------------------------------------------------------------------------
+// Region Multiply Benchmarks
+//------------------------------------------------------------------------------
+//
+// Multiply-a-buffer-by-constant (dst = c * src) and multiply-accumulate
+// (dst ^= c * src) over byte regions. The gfb split-table kernels take
+// {kernel, bytes}; the Givaro and xgalois loops take {m, bytes} and run over
+// the same operand values. bytes_per_second counts region bytes (m / 8 per
+// element) for every backend so the GB/s figures are directly comparable.
+// Each gfb kernel is first checked against the scalar kernel and skipped
+// with an error if they disagree.
+
+const std::vector<int64_t> REGION_BYTES = {4 << 10, 64 << 10, 1 << 20, 16 << 20};
+
+static void RegionKernelArguments(benchmark::internal::Benchmark *b) {
+  for (gfb::RegionKernel kernel : gfb::ALL_REGION_KERNELS) {
+    if (!gfb::RegionKernelSupported(kernel)) continue;
+    for (int64_t bytes : REGION_BYTES) {
+      b->Args({static_cast<int64_t>(kernel), bytes});
+    }
+  }
+}
+
+static void RegionLoopArguments(benchmark::internal::Benchmark *b) {
+  for (int64_t m : {8, 16}) {
+    for (int64_t bytes : REGION_BYTES) {
+      b->Args({m, bytes});
+    }
+  }
+}
+
+// Region contents as polynomial-basis values in [0, 2^m), zeros included
+std::vector<uint32_t> GenerateRandomRegionValues(size_t count, uint8_t m,
+                                                 uint32_t seed = 42) {
+  gfb::OperandCorpus corpus =
+      GetOperandCorpus(m, count, seed, gfb::OperandDistribution::kUniform);
+  return std::vector<uint32_t>(corpus.data(), corpus.data() + count);
+}
+
+// Nonzero multiplier shared by every region benchmark of a given degree
+uint32_t GetRegionConstant(uint8_t m) {
+  std::mt19937 gen(43);
+  std::uniform_int_distribution<uint32_t> dis(1, (1u << m) - 1);
+  return dis(gen);
+}
+
+// One untimed pass of kernel against the scalar kernel. Both start from a
+// copy of src, so MultiplyAdd accumulates into nonzero data, and skip the
+// last element, so the scalar tail after the vector loop runs too.
+template <bool Accumulate, typename Region, typename Word>
+static bool RegionMatchesScalar(const Region &region, Word c,
+                                const std::vector<Word> &src,
+                                gfb::RegionKernel kernel) {
+  const size_t n = src.size() - 1;
+  std::vector<Word> expected(src), actual(src);
+  if (Accumulate) {
+    region.MultiplyAdd(c, src.data(), expected.data(), n, gfb::RegionKernel::kScalar);
+    region.MultiplyAdd(c, src.data(), actual.data(), n, kernel);
+  } else {
+    region.Multiply(c, src.data(), expected.data(), n, gfb::RegionKernel::kScalar);
+    region.Multiply(c, src.data(), actual.data(), n, kernel);
+  }
+  return actual == expected;
+}
+
+static void SetRegionCounters(benchmark::State &state, size_t bytes) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+  state.counters["RegionBytes"] = static_cast<double>(bytes);
+}
+
+template <bool Accumulate>
+static void RegionGF2_8(benchmark::State &state) {
+  auto kernel = static_cast<gfb::RegionKernel>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  gfb::GF2_8Region region(GetIrreduciblePolyBits(8));
+
+  auto values = GenerateRandomRegionValues(bytes, 8);
+  std::vector<uint8_t> src(values.begin(), values.end());
+  std::vector<uint8_t> dst(bytes);
+  auto c = static_cast<uint8_t>(GetRegionConstant(8));
+  if (!RegionMatchesScalar<Accumulate>(region, c, src, kernel)) {
+    state.SkipWithError("Region kernel disagrees with the scalar kernel");
+    return;
+  }
+
+  for (auto _ : WithPerfCounters(state)) {
+    if (Accumulate) {
+      region.MultiplyAdd(c, src.data(), dst.data(), bytes, kernel);
+    } else {
+      region.Multiply(c, src.data(), dst.data(), bytes, kernel);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(gfb::RegionKernelName(kernel));
+  SetRegionCounters(state, bytes);
+}
+
+template <bool Accumulate>
+static void RegionGF2_16(benchmark::State &state) {
+  auto kernel = static_cast<gfb::RegionKernel>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  size_t n = bytes / sizeof(uint16_t);
+  gfb::GF2_16Region region(GetIrreduciblePolyBits(16));
+
+  auto values = GenerateRandomRegionValues(n, 16);
+  std::vector<uint16_t> src(values.begin(), values.end());
+  std::vector<uint16_t> dst(n);
+  auto c = static_cast<uint16_t>(GetRegionConstant(16));
+  if (!RegionMatchesScalar<Accumulate>(region, c, src, kernel)) {
+    state.SkipWithError("Region kernel disagrees with the scalar kernel");
+    return;
+  }
+
+  for (auto _ : WithPerfCounters(state)) {
+    // Split tables are rebuilt per call, as a caller with a new constant would
+    if (Accumulate) {
+      region.MultiplyAdd(c, src.data(), dst.data(), n, kernel);
+    } else {
+      region.Multiply(c, src.data(), dst.data(), n, kernel);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetLabel(gfb::RegionKernelName(kernel));
+  SetRegionCounters(state, bytes);
+}
+
+static void BM_Region_GF2_8_Multiply(benchmark::State &state) {
+  RegionGF2_8<false>(state);
+}
+
+static void BM_Region_GF2_8_MultiplyAdd(benchmark::State &state) {
+  RegionGF2_8<true>(state);
+}
+
+static void BM_Region_GF2_16_Multiply(benchmark::State &state) {
+  RegionGF2_16<false>(state);
+}
+
+static void BM_Region_GF2_16_MultiplyAdd(benchmark::State &state) {
+  RegionGF2_16<true>(state);
+}
+
+static void BM_Givaro_RegionMultiply(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  size_t n = bytes / (m / 8);
+  std::vector<int> poly = GetGivaroIrreduciblePoly(m);
+  Givaro::GFq<int64_t> field(2, m, poly);
+
+  auto values = GenerateRandomRegionValues(n, m);
+  std::vector<Givaro::GFq<int64_t>::Element> src(n), dst(n);
+  for (size_t i = 0; i < n; ++i) {
+    field.init(src[i], values[i]);
+  }
+  Givaro::GFq<int64_t>::Element c;
+  field.init(c, GetRegionConstant(m));
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < n; ++i) {
+      field.mul(dst[i], c, src[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  SetRegionCounters(state, bytes);
+}
+
+static void BM_Givaro_RegionMultiplyAdd(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  size_t n = bytes / (m / 8);
+  std::vector<int> poly = GetGivaroIrreduciblePoly(m);
+  Givaro::GFq<int64_t> field(2, m, poly);
+
+  auto values = GenerateRandomRegionValues(n, m);
+  std::vector<Givaro::GFq<int64_t>::Element> src(n), dst(n, field.zero);
+  for (size_t i = 0; i < n; ++i) {
+    field.init(src[i], values[i]);
+  }
+  Givaro::GFq<int64_t>::Element c;
+  field.init(c, GetRegionConstant(m));
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < n; ++i) {
+      field.axpyin(dst[i], c, src[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  SetRegionCounters(state, bytes);
+}
+
+static void BM_Xgalois_RegionMultiply(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  size_t n = bytes / (m / 8);
+  xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
+
+  std::vector<uint32_t> src = GenerateRandomRegionValues(n, m);
+  std::vector<uint32_t> dst(n);
+  uint32_t c = GetRegionConstant(m);
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < n; ++i) {
+      dst[i] = field.Mul(c, src[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+
+  SetRegionCounters(state, bytes);
+}
+
+static void BM_Xgalois_RegionMultiplyAdd(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t bytes = static_cast<size_t>(state.range(1));
+  size_t n = bytes / (m / 8);
+  xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
+
+  std::vector<uint32_t> src = GenerateRandomRegionValues(n, m);
+  std::vector<uint32_t> dst(n, 0);
+  uint32_t c = GetRegionConstant(m);
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < n; ++i) {
+      dst[i] = field.Add(dst[i], field.Mul(c, src[i]));
+    }
+    benchmark::ClobberMemory();
+  }
+
+  SetRegionCounters(state, bytes);
+}
+
+//------------------------------------------------------------------------------
+// Carry-less Multiply (CLMUL) Benchmarks
+//------------------------------------------------------------------------------
+//
+// gfb::GF2mClmul keeps elements as bit vectors and multiplies with one
+// PCLMULQDQ/PMULL, so its cost does not grow with 2^m the way table lookups
+// do. It runs over FIELD_DEGREES with the same moduli as the table backends
+// (to locate the crossover) and continues to m = 64, with both sparse and
+// Barrett reduction where the modulus allows. gfb::GF2mClmulWide covers the
+// multi-word degrees 128, 163 and 233. NTL is benchmarked at the same large
+// degrees, moduli and operand values as the reference.
+
+// Single-word degrees; FIELD_DEGREES plus the range tables cannot reach
+const std::vector<uint8_t> CLMUL_DEGREES = {4,  8,  12, 16, 20, 24,
+                                            32, 40, 48, 56, 64};
+
+// Multi-word degrees: the GCM field and the NIST B-163/B-233 fields
+const std::vector<uint16_t> CLMUL_WIDE_DEGREES = {128, 163, 233};
+
+// Modulus middle terms (exponents strictly between 0 and m). Degrees up to
+// 32 reuse the shared polynomials, higher single-word degrees use the
+// minimal-weight sparse irreducible polynomial.
+std::vector<uint16_t> GetClmulMiddleTerms(uint16_t m) {
+  switch (m) {
+    case 128: return {7, 2, 1};    // x^128 + x^7 + x^2 + x + 1
+    case 163: return {7, 6, 3};    // x^163 + x^7 + x^6 + x^3 + 1
+    case 233: return {74};         // x^233 + x^74 + 1
+    default: break;
+  }
+  uint8_t degree = static_cast<uint8_t>(m);
+  uint64_t low = m <= gfb::kMaxModulusDegree
+                     ? GetModulus(degree) ^ (uint64_t{1} << m)
+                     : gfb::FindSparseIrreducible(degree);
+  std::vector<uint16_t> terms;
+  for (uint16_t k = m - 1; k > 0; --k) {
+    if ((low >> k) & 1) terms.push_back(k);
+  }
+  return terms;
+}
+
+uint64_t GetClmulModulusLow(uint8_t m) {
+  uint64_t low = 1;
+  for (uint16_t k : GetClmulMiddleTerms(m)) low |= uint64_t{1} << k;
+  return low;
+}
+
+NTL::GF2X GetNTLSparsePoly(uint16_t m) {
+  NTL::GF2X poly;
+  NTL::SetCoeff(poly, m);
+  for (uint16_t k : GetClmulMiddleTerms(m)) NTL::SetCoeff(poly, k);
+  NTL::SetCoeff(poly, 0);
+  return poly;
+}
+
+// Arguments are {m, reduction}; sparse only where the modulus qualifies
+static void ClmulArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CLMUL_DEGREES) {
+    gfb::GF2mClmul field(m, GetClmulModulusLow(m));
+    if (field.Reduction() == gfb::ClmulReduction::kSparse) {
+      b->Args({m, static_cast<int64_t>(gfb::ClmulReduction::kSparse)});
+    }
+    b->Args({m, static_cast<int64_t>(gfb::ClmulReduction::kBarrett)});
+  }
+}
+
+// Degrees above FIELD_DEGREES, for NTL at the same moduli as CLMUL
+static void ClmulLargeArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CLMUL_DEGREES) {
+    if (m > FIELD_DEGREES.back()) b->Arg(m);
+  }
+  for (uint16_t m : CLMUL_WIDE_DEGREES) b->Arg(m);
+}
+
+static void ClmulWideArguments(benchmark::internal::Benchmark *b) {
+  for (uint16_t m : CLMUL_WIDE_DEGREES) b->Arg(m);
+}
+
+// Random nonzero elements as words of m-bit polynomials, `words` per element
+std::vector<uint64_t> GenerateRandomClmulWords(uint16_t m, size_t words,
+                                               size_t count,
+                                               uint32_t seed = 42) {
+  std::mt19937_64 gen(seed);
+  std::vector<uint64_t> values(count * words);
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t *element = &values[i * words];
+    for (size_t w = 0; w < words; ++w) {
+      size_t bits = m > 64 * w ? m - 64 * w : 0;
+      uint64_t mask = bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+      element[w] = gen() & mask;
+    }
+    element[0] |= element[0] == 0; // avoid zero
+  }
+  return values;
+}
+
+// Invokes fn with the GF2mClmulWide instance for one of CLMUL_WIDE_DEGREES
+template <typename Fn> void WithGF2mClmulWide(uint16_t m, Fn &&fn) {
+  if (m <= 128) {
+    fn(gfb::GF2mClmulWide<2>(m, GetClmulMiddleTerms(m)));
+  } else if (m <= 192) {
+    fn(gfb::GF2mClmulWide<3>(m, GetClmulMiddleTerms(m)));
+  } else {
+    fn(gfb::GF2mClmulWide<4>(m, GetClmulMiddleTerms(m)));
+  }
+}
+
+template <typename Field>
+std::vector<typename Field::Element>
+GenerateRandomClmulWideElements(const Field &field, size_t count,
+                                uint32_t seed = 42) {
+  using Element = typename Field::Element;
+  const size_t words = std::tuple_size<Element>::value;
+  std::vector<uint64_t> values =
+      GenerateRandomClmulWords(field.Degree(), words, count, seed);
+  std::vector<Element> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    std::copy_n(&values[i * words], words, elements[i].begin());
+  }
+  return elements;
+}
+
+static void SetClmulCounters(benchmark::State &state, uint16_t m) {
+  MemoryUsage mem_end = GetMemoryUsage();
+  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
+  state.counters["FieldDegree"] = m;
+  state.counters["HardwareClmul"] = gfb::ClmulIsHardware() ? 1 : 0;
+}
+
+static void BM_Clmul_Multiplication(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto reduction = static_cast<gfb::ClmulReduction>(state.range(1));
+  gfb::GF2mClmul field(m, GetClmulModulusLow(m), reduction);
+
+  auto elements = GenerateRandomClmulWords(m, 1, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    auto result = field.Mul(elements[idx % elements.size()],
+                            elements[(idx + 1) % elements.size()]);
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+  state.SetLabel(gfb::ClmulReductionName(reduction));
+}
+
+static void BM_Clmul_Division(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto reduction = static_cast<gfb::ClmulReduction>(state.range(1));
+  gfb::GF2mClmul field(m, GetClmulModulusLow(m), reduction);
+
+  auto elements = GenerateRandomClmulWords(m, 1, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    auto result = field.Div(elements[idx % elements.size()],
+                            elements[(idx + 1) % elements.size()]);
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+  state.SetLabel(gfb::ClmulReductionName(reduction));
+}
+
+static void BM_Clmul_Inversion(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto reduction = static_cast<gfb::ClmulReduction>(state.range(1));
+  gfb::GF2mClmul field(m, GetClmulModulusLow(m), reduction);
+
+  auto elements = GenerateRandomClmulWords(m, 1, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    auto result = field.Inv(elements[idx % elements.size()]);
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+  state.SetLabel(gfb::ClmulReductionName(reduction));
+}
+
+static void BM_ClmulWide_Multiplication(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  WithGF2mClmulWide(m, [&](const auto &field) {
+    auto elements = GenerateRandomClmulWideElements(field, 10000);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      auto result = field.Mul(elements[idx % elements.size()],
+                              elements[(idx + 1) % elements.size()]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+  });
+  SetClmulCounters(state, m);
+}
+
+static void BM_ClmulWide_Division(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  WithGF2mClmulWide(m, [&](const auto &field) {
+    auto elements = GenerateRandomClmulWideElements(field, 10000);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      auto result = field.Div(elements[idx % elements.size()],
+                              elements[(idx + 1) % elements.size()]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+  });
+  SetClmulCounters(state, m);
+}
+
+static void BM_ClmulWide_Inversion(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  WithGF2mClmulWide(m, [&](const auto &field) {
+    auto elements = GenerateRandomClmulWideElements(field, 10000);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      auto result = field.Inv(elements[idx % elements.size()]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+  });
+  SetClmulCounters(state, m);
+}
+
+// NTL elements with the same values as GenerateRandomClmulWords(m, ...)
+std::vector<NTL::GF2E> GenerateRandomNTLLargeElements(uint16_t m, size_t count,
+                                                      uint32_t seed = 42) {
+  const size_t words = (m + 63) / 64;
+  std::vector<uint64_t> values = GenerateRandomClmulWords(m, words, count, seed);
+  std::vector<NTL::GF2E> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    NTL::GF2X poly;
+    for (long bit = 0; bit < m; ++bit) {
+      if ((values[i * words + bit / 64] >> (bit % 64)) & 1) {
+        NTL::SetCoeff(poly, bit);
+      }
+    }
+    NTL::conv(elements[i], poly);
+  }
+  return elements;
+}
+
+static void BM_NTL_LargeMultiplication(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  NTL::GF2E::init(GetNTLSparsePoly(m));
+
+  auto elements = GenerateRandomNTLLargeElements(m, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    NTL::GF2E result = elements[idx % elements.size()] * elements[(idx + 1) % elements.size()];
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+}
+
+static void BM_NTL_LargeDivision(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  NTL::GF2E::init(GetNTLSparsePoly(m));
+
+  auto elements = GenerateRandomNTLLargeElements(m, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    NTL::GF2E result = elements[idx % elements.size()] / elements[(idx + 1) % elements.size()];
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+}
+
+static void BM_NTL_LargeInversion(benchmark::State &state) {
+  uint16_t m = static_cast<uint16_t>(state.range(0));
+  NTL::GF2E::init(GetNTLSparsePoly(m));
+
+  auto elements = GenerateRandomNTLLargeElements(m, 10000);
+  size_t idx = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    NTL::GF2E result = NTL::inv(elements[idx % elements.size()]);
+    benchmark::DoNotOptimize(result);
+    idx++;
+  }
+
+  SetClmulCounters(state, m);
+}
+
+//------------------------------------------------------------------------------
+// Field Adapters
+//------------------------------------------------------------------------------
+//
+// A uniform Givaro-style interface over every backend, with output
+// parameters so heavyweight elements (NTL::GF2E) are not copied. Used by
+// gfb::ReedSolomon (see gfb/code/reed_solomon.hpp) and by every benchmark
+// that is written once and instantiated per backend: per-op, bulk, latency,
+// throughput and cache sweeps. The wrappers are header-inline and dispatch
+// is resolved at compile time, so they add no call overhead to the wrapped
+// operation.
+
+enum class FieldOp { kAddition, kMultiplication, kDivision, kInversion };
+
+template <FieldOp Op> using FieldOpTag = std::integral_constant<FieldOp, Op>;
+
+const char *FieldOpName(FieldOp op) {
+  switch (op) {
+    case FieldOp::kAddition: return "Addition";
+    case FieldOp::kMultiplication: return "Multiplication";
+    case FieldOp::kDivision: return "Division";
+    default: return "Inversion";
+  }
+}
+
+// Calls fn(FieldOpTag<Op>{}) for each op, in declaration order
+template <typename Fn> void ForEachFieldOp(Fn &&fn) {
+  fn(FieldOpTag<FieldOp::kAddition>{});
+  fn(FieldOpTag<FieldOp::kMultiplication>{});
+  fn(FieldOpTag<FieldOp::kDivision>{});
+  fn(FieldOpTag<FieldOp::kInversion>{});
+}
+
+// What a benchmark needs from a backend. Name() is the name used in
+// benchmark names, kElementBytes the memory traffic per element for bytes/s,
+// and MeasureFootprint(m) the heap and RSS cost of one field instance.
+template <typename F>
+concept FieldBackend = requires(const F &field, typename F::Element &r,
+                                const typename F::Element &a, uint32_t value,
+                                uint8_t m) {
+  { F::Name() } -> std::convertible_to<const char *>;
+  { F::kElementBytes } -> std::convertible_to<size_t>;
+  { F::MeasureFootprint(m) } -> std::same_as<FieldFootprint>;
+  { field.Order() } -> std::convertible_to<uint64_t>;
+  field.Init(r, value);
+  { field.IsZero(a) } -> std::convertible_to<bool>;
+  field.Add(r, a, a);
+  field.Mul(r, a, a);
+  field.MulAdd(r, a, a);
+  field.Div(r, a, a);
+  field.Inv(r, a);
+};
+
+// Table backends also report the bytes their tables occupy
+template <typename F>
+concept TableFieldBackend = FieldBackend<F> && requires(const F &field) {
+  { field.TableBytes() } -> std::convertible_to<size_t>;
+};
+
+class GivaroFieldAdapter {
+public:
+  using Field = Givaro::GFq<int64_t>;
+  using Element = Field::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit GivaroFieldAdapter(uint8_t m) : field_(2, m, GetGivaroIrreduciblePoly(m)) {}
+
+  static const char *Name() { return "Givaro"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) { return MeasureGivaroFootprint(m); }
+
+  uint64_t Order() const { return field_.cardinality(); }
+  // Log, antilog and Zech tables of q entries each
+  size_t TableBytes() const { return 3 * Order() * sizeof(Element); }
+  void Init(Element &r, uint32_t value) const { field_.init(r, value); }
+  bool IsZero(const Element &a) const { return field_.isZero(a); }
+  void Add(Element &r, const Element &a, const Element &b) const { field_.add(r, a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { field_.mul(r, a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { field_.axpyin(r, a, x); }
+  void Div(Element &r, const Element &a, const Element &b) const { field_.div(r, a, b); }
+  void Inv(Element &r, const Element &a) const { field_.inv(r, a); }
+
+private:
+  Field field_;
+};
+
+class XgaloisFieldAdapter {
+public:
+  using Element = uint32_t;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit XgaloisFieldAdapter(uint8_t m) : field_(m, "log", GetIrreduciblePoly(m)) {}
+
+  static const char *Name() { return "Xgalois"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) { return MeasureXgaloisFootprint(m); }
+
+  uint64_t Order() const { return field_.Order(); }
+  // Log and antilog tables of q entries each
+  size_t TableBytes() const { return 2 * Order() * sizeof(Element); }
+  void Init(Element &r, uint32_t value) const { r = value; }
+  bool IsZero(const Element &a) const { return a == 0; }
+  void Add(Element &r, const Element &a, const Element &b) const { r = field_.Add(a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = field_.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r = field_.Add(r, field_.Mul(a, x)); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = field_.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = field_.Inv(a); }
+
+private:
+  xg::GF2XZECH field_;
+};
+
+// Installs the NTL::GF2E modulus on construction. NTL keeps the modulus per
+// thread, so any other thread using the instance installs it through a
+// ThreadScope first. The scratch element keeps MulAdd from allocating, so
+// MulAdd must not be called from several threads at once.
+class NTLFieldAdapter {
+public:
+  using Element = NTL::GF2E;
+  // A GF2E is a handle to a heap-allocated word vector; for the degrees
+  // benchmarked here the payload is one machine word per element
+  static constexpr size_t kElementBytes = sizeof(unsigned long);
+
+  explicit NTLFieldAdapter(uint8_t m) : m_(m) {
+    NTL::GF2E::init(GetNTLIrreduciblePoly(m));
+    context_.save();
+  }
+
+  // Installs the field's modulus in the calling thread, restoring the
+  // thread's previous one on exit
+  class ThreadScope {
+  public:
+    explicit ThreadScope(const NTLFieldAdapter &field) : push_(field.context_) {}
+
+  private:
+    NTL::GF2EPush push_;
+  };
+
+  static const char *Name() { return "NTL"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) { return MeasureNTLFootprint(m); }
+
+  uint64_t Order() const { return uint64_t{1} << m_; }
+  void Init(Element &r, uint32_t value) const { ConvertNTLElement(r, value); }
+  bool IsZero(const Element &a) const { return NTL::IsZero(a); }
+  void Add(Element &r, const Element &a, const Element &b) const { NTL::add(r, a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { NTL::mul(r, a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const {
+    NTL::mul(scratch_, a, x);
+    NTL::add(r, r, scratch_);
+  }
+  void Div(Element &r, const Element &a, const Element &b) const { NTL::div(r, a, b); }
+  void Inv(Element &r, const Element &a) const { NTL::inv(r, a); }
+
+private:
+  uint8_t m_;
+  NTL::GF2EContext context_;
+  mutable NTL::GF2E scratch_;
+};
+
+template <typename IndexT, gfb::ZechLayout Layout = gfb::ZechLayout::kFull>
+class ZechFieldAdapter {
+public:
+  using Field = gfb::GF2mZech<IndexT, Layout>;
+  using Element = typename Field::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit ZechFieldAdapter(uint8_t m) : field_(m, GetIrreduciblePolyBits(m)) {}
+
+  static const char *Name() { return Layout == gfb::ZechLayout::kFull ? "Zech" : "ZechHalf"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) {
+    return MeasureZechFootprint<IndexT, Layout>(m);
+  }
+
+  uint64_t Order() const { return field_.Order(); }
+  size_t TableBytes() const { return field_.TableBytes(); }
+  void Init(Element &r, uint32_t value) const { r = field_.FromPolynomial(value); }
+  bool IsZero(const Element &a) const { return field_.IsZero(a); }
+  void Add(Element &r, const Element &a, const Element &b) const { r = field_.Add(a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = field_.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r = field_.Add(r, field_.Mul(a, x)); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = field_.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = field_.Inv(a); }
+
+private:
+  Field field_;
+};
+
+template <typename IndexT, gfb::LogLayout Layout> class LogFieldAdapter {
+public:
+  using Field = gfb::GF2mLog<IndexT, Layout>;
+  using Element = typename Field::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit LogFieldAdapter(uint8_t m) : field_(m, GetIrreduciblePolyBits(m)) {}
+
+  static const char *Name() {
+    return Layout == gfb::LogLayout::kSeparate ? "Log" : "LogInterleaved";
+  }
+  static FieldFootprint MeasureFootprint(uint8_t m) {
+    return MeasureLogFootprint<IndexT, Layout>(m);
+  }
+
+  uint64_t Order() const { return field_.Order(); }
+  size_t TableBytes() const { return field_.TableBytes(); }
+  void Init(Element &r, uint32_t value) const { r = static_cast<Element>(value); }
+  bool IsZero(const Element &a) const { return field_.IsZero(a); }
+  void Add(Element &r, const Element &a, const Element &b) const { r = field_.Add(a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = field_.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r ^= field_.Mul(a, x); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = field_.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = field_.Inv(a); }
+
+private:
+  Field field_;
+};
+
+class ClmulFieldAdapter {
+public:
+  using Element = gfb::GF2mClmul::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit ClmulFieldAdapter(uint8_t m) : field_(m, GetClmulModulusLow(m)) {}
+
+  static const char *Name() { return "Clmul"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) {
+    return MeasureClmulFootprint(m, GetClmulModulusLow(m));
+  }
+
+  uint64_t Order() const { return field_.Order(); }
+  void Init(Element &r, uint32_t value) const { r = value; }
+  bool IsZero(const Element &a) const { return a == 0; }
+  void Add(Element &r, const Element &a, const Element &b) const { r = a ^ b; }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = field_.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r ^= field_.Mul(a, x); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = field_.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = field_.Inv(a); }
+
+private:
+  gfb::GF2mClmul field_;
+};
+
+// Init maps the shared polynomial-basis values into the tower basis, so the
+// tower works on the same field elements as every other backend; results
+// stay in the tower basis. TableBytes covers the GF(2^8) tables the
+// arithmetic reads, not the basis map used only by Init.
+template <typename Tower> class TowerFieldAdapter {
+public:
+  using Element = typename Tower::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit TowerFieldAdapter(uint8_t m) : tower_(m) {}
+
+  static const char *Name() { return "Tower"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) { return MeasureTowerFootprint<Tower>(m); }
+
+  uint64_t Order() const { return tower_.field.Order(); }
+  size_t TableBytes() const { return tower_.field.TableBytes(); }
+  void Init(Element &r, uint32_t value) const { r = tower_.map.ToField(value); }
+  bool IsZero(const Element &a) const { return a == 0; }
+  void Add(Element &r, const Element &a, const Element &b) const { r = tower_.field.Add(a, b); }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = tower_.field.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r = tower_.field.Add(r, tower_.field.Mul(a, x)); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = tower_.field.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = tower_.field.Inv(a); }
+
+private:
+  TowerField<Tower> tower_;
+};
+
+// Init maps the shared polynomial-basis values into the normal basis, as for
+// the tower. Square and Sqrt are the basis' rotations; backends without them
+// square by multiplication (see ApplySquare).
+class NormalFieldAdapter {
+public:
+  using Element = gfb::GF2mNormal::Element;
+  static constexpr size_t kElementBytes = sizeof(Element);
+
+  explicit NormalFieldAdapter(uint8_t m) : normal_(m) {}
+
+  static const char *Name() { return "Normal"; }
+  static FieldFootprint MeasureFootprint(uint8_t m) { return MeasureNormalFootprint(m); }
+
+  uint64_t Order() const { return normal_.field.Order(); }
+  void Init(Element &r, uint32_t value) const { r = normal_.map.ToField(value); }
+  bool IsZero(const Element &a) const { return a == 0; }
+  void Add(Element &r, const Element &a, const Element &b) const { r = a ^ b; }
+  void Mul(Element &r, const Element &a, const Element &b) const { r = normal_.field.Mul(a, b); }
+  void MulAdd(Element &r, const Element &a, const Element &x) const { r ^= normal_.field.Mul(a, x); }
+  void Div(Element &r, const Element &a, const Element &b) const { r = normal_.field.Div(a, b); }
+  void Inv(Element &r, const Element &a) const { r = normal_.field.Inv(a); }
+  void Square(Element &r, const Element &a) const { r = normal_.field.Square(a); }
+  void Sqrt(Element &r, const Element &a) const { r = normal_.field.Sqrt(a); }
+  void Trace(Element &r, const Element &a) const { r = normal_.field.Trace(a); }
+  bool SolveQuadratic(Element &z, const Element &c) const {
+    return normal_.field.SolveQuadratic(c, z);
+  }
+
+private:
+  NormalField normal_;
+};
+
+static_assert(TableFieldBackend<GivaroFieldAdapter>);
+static_assert(TableFieldBackend<XgaloisFieldAdapter>);
+static_assert(FieldBackend<NTLFieldAdapter>);
+static_assert(TableFieldBackend<ZechFieldAdapter<uint16_t>>);
+static_assert(TableFieldBackend<ZechFieldAdapter<uint32_t>>);
+static_assert(TableFieldBackend<ZechFieldAdapter<uint16_t, gfb::ZechLayout::kHalf>>);
+static_assert(TableFieldBackend<LogFieldAdapter<uint16_t, gfb::LogLayout::kSeparate>>);
+static_assert(TableFieldBackend<LogFieldAdapter<uint16_t, gfb::LogLayout::kInterleaved>>);
+static_assert(FieldBackend<ClmulFieldAdapter>);
+static_assert(TableFieldBackend<TowerFieldAdapter<gfb::GF2mTower16>>);
+static_assert(TableFieldBackend<TowerFieldAdapter<gfb::GF2mTower32>>);
+static_assert(FieldBackend<NormalFieldAdapter>);
+
+// Names the Zech backend in templates; the adapter type is chosen per m,
+// with the narrowest entry type
+struct ZechBackend {
+  static const char *Name() { return "Zech"; }
+};
+
+// Names the tower backend in templates; the adapter type is chosen per m
+// (16 or 32)
+struct TowerBackend {
+  static const char *Name() { return "Tower"; }
+};
+
+// Invokes fn(std::type_identity<Adapter>{}) with the adapter type Backend
+// uses for degree m, without building it
+template <typename Backend, typename Fn> void WithFieldBackendType(uint8_t m, Fn &&fn) {
+  if constexpr (std::is_same_v<Backend, ZechBackend>) {
+    if (m <= 16) {
+      fn(std::type_identity<ZechFieldAdapter<uint16_t>>{});
+    } else {
+      fn(std::type_identity<ZechFieldAdapter<uint32_t>>{});
+    }
+  } else if constexpr (std::is_same_v<Backend, TowerBackend>) {
+    if (m == 16) {
+      fn(std::type_identity<TowerFieldAdapter<gfb::GF2mTower16>>{});
+    } else {
+      fn(std::type_identity<TowerFieldAdapter<gfb::GF2mTower32>>{});
+    }
+  } else {
+    fn(std::type_identity<Backend>{});
+  }
+}
+
+// Per-thread setup an adapter needs before a thread other than its builder
+// touches its elements: Adapter::ThreadScope where defined (NTL), else none
+template <typename Adapter> struct AdapterThreadScope {
+  explicit AdapterThreadScope(const Adapter &) {}
+};
+template <typename Adapter>
+  requires requires { typename Adapter::ThreadScope; }
+struct AdapterThreadScope<Adapter> : Adapter::ThreadScope {
+  explicit AdapterThreadScope(const Adapter &field) : Adapter::ThreadScope(field) {}
+};
+
+// Invokes fn with the adapter of Backend built for degree m
+template <typename Backend, typename Fn> void WithFieldBackend(uint8_t m, Fn &&fn) {
+  WithFieldBackendType<Backend>(m, [&]<typename Adapter>(std::type_identity<Adapter>) {
+    fn(Adapter(m));
+  });
+}
+
+// Random nonzero operands from the shared corpus, so multiplicative chains
+// never reach zero and divisors are valid. Every adapter op accepts its
+// output aliased to an input.
+template <FieldBackend Field>
+std::vector<typename Field::Element>
+GenerateRandomAdapterElements(const Field &field, size_t count,
+                              uint32_t seed = 42) {
+  gfb::OperandCorpus corpus = GetOperandCorpus(OrderDegree(field.Order()), count, seed);
+  std::vector<typename Field::Element> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    field.Init(elements[i], corpus[i]);
+  }
+  return elements;
+}
+
+template <FieldOp Op, FieldBackend Field>
+inline void ApplyFieldOp(const Field &field, typename Field::Element &r,
+                         const typename Field::Element &a,
+                         const typename Field::Element &b) {
+  if constexpr (Op == FieldOp::kAddition) field.Add(r, a, b);
+  if constexpr (Op == FieldOp::kMultiplication) field.Mul(r, a, b);
+  if constexpr (Op == FieldOp::kDivision) field.Div(r, a, b);
+  if constexpr (Op == FieldOp::kInversion) field.Inv(r, a);
+}
+
+//------------------------------------------------------------------------------
+// Per-op and Bulk (Array) Throughput Benchmarks
+//------------------------------------------------------------------------------
+//
+// One body per mode, instantiated for each backend x op and registered per
+// degree (see Benchmark Registration):
+//  - per-op: one op per iteration over a 10K operand stream, registered as
+//    BM_<backend>_<op>/<tier>/<m> for every degree the backend reaches;
+//  - bulk: each iteration applies one op over whole contiguous buffers
+//    (c[i] = a[i] op b[i], or c[i] = s * a[i] for the scalar variant), so
+//    the reported items/s and bytes/s reflect batch throughput rather than
+//    per-call overhead. Arguments are {m, n} with n swept from 1K to 16M
+//    elements.
+
+// Sizes of the operand buffers, in elements
+const int64_t BULK_MIN_ELEMENTS = 1 << 10;
+const int64_t BULK_MAX_ELEMENTS = 1 << 24;
+
+// NTL::GF2E keeps each element in its own heap block, so three 16M element
+// buffers do not fit comfortably in memory; NTL stops at 1M elements.
+const int64_t BULK_MAX_NTL_ELEMENTS = 1 << 20;
+
+static void BulkArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    for (int64_t n = BULK_MIN_ELEMENTS; n <= BULK_MAX_ELEMENTS; n *= 4) {
+      b->Args({m, n});
+    }
+  }
+}
+
+static void BulkNTLArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    for (int64_t n = BULK_MIN_ELEMENTS; n <= BULK_MAX_NTL_ELEMENTS; n *= 4) {
+      b->Args({m, n});
+    }
+  }
+}
+
+// Report elements/s and bytes/s for a span of n elements where every element
+// touches `operands` input values and one output value of `element_bytes`.
+static void SetBulkCounters(benchmark::State &state, size_t n,
+                            size_t element_bytes, size_t operands) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * n *
+                                               element_bytes * (operands + 1)));
+  state.counters["Elements"] = benchmark::Counter(
+      static_cast<double>(n), benchmark::Counter::kAvgThreads);
+}
+
+const size_t PER_OP_STREAM = 10000;
+
+template <typename Backend, FieldOp Op>
+static void BM_FieldOp(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    auto elements = GenerateRandomAdapterElements(field, PER_OP_STREAM);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      typename Field::Element result;
+      ApplyFieldOp<Op>(field, result, elements[idx % elements.size()],
+                       elements[(idx + 1) % elements.size()]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+
+    SetMemoryCounters(state, Field::MeasureFootprint(m));
+    state.counters["FieldOrder"] = static_cast<double>(field.Order());
+    if constexpr (TableFieldBackend<Field>) {
+      state.counters["TableBytes"] = static_cast<double>(field.TableBytes());
+    }
+  });
+}
+
+template <typename Backend, FieldOp Op>
+static void BM_FieldBulk(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t n = static_cast<size_t>(state.range(1));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    auto a = GenerateRandomAdapterElements(field, n, 42);
+    auto b = GenerateRandomAdapterElements(field, n, 43);
+    std::vector<typename Field::Element> c(n);
+
+    for (auto _ : WithPerfCounters(state)) {
+      for (size_t i = 0; i < n; ++i) {
+        ApplyFieldOp<Op>(field, c[i], a[i], b[i]);
+      }
+      benchmark::ClobberMemory();
+    }
+
+    SetBulkCounters(state, n, Field::kElementBytes,
+                    Op == FieldOp::kInversion ? 1 : 2);
+    state.counters["FieldOrder"] = benchmark::Counter(
+        static_cast<double>(field.Order()), benchmark::Counter::kAvgThreads);
+  });
+}
+
+template <typename Backend>
+static void BM_FieldBulkScalar(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t n = static_cast<size_t>(state.range(1));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    auto a = GenerateRandomAdapterElements(field, n, 42);
+    auto scalar = GenerateRandomAdapterElements(field, 1, 43)[0];
+    std::vector<typename Field::Element> c(n);
+
+    for (auto _ : WithPerfCounters(state)) {
+      for (size_t i = 0; i < n; ++i) {
+        field.Mul(c[i], scalar, a[i]);
+      }
+      benchmark::ClobberMemory();
+    }
+
+    SetBulkCounters(state, n, Field::kElementBytes, 1);
+    state.counters["FieldOrder"] = benchmark::Counter(
+        static_cast<double>(field.Order()), benchmark::Counter::kAvgThreads);
+  });
+}
+
+// Registers BM_<backend>_<op>/<tier> for every degree up to max_degree
+template <typename Backend> static void RegisterOpBenchmarks(uint8_t max_degree) {
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    const std::string name =
+        std::string("BM_") + Backend::Name() + "_" + FieldOpName(Op);
+    RegisterPerDegree(name.c_str(), BM_FieldOp<Backend, Op>, max_degree);
+  });
+}
+
+// Registers BM_<backend>_Bulk<op> and BM_<backend>_BulkScalarMultiplication
+template <typename Backend>
+static void RegisterBulkBenchmarks(void (*arguments)(benchmark::internal::Benchmark *)) {
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_Bulk";
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    benchmark::RegisterBenchmark((prefix + FieldOpName(Op)).c_str(),
+                                 BM_FieldBulk<Backend, Op>)
+        ->Apply(arguments)->Unit(benchmark::kMicrosecond);
+  });
+  benchmark::RegisterBenchmark((prefix + "ScalarMultiplication").c_str(),
+                               BM_FieldBulkScalar<Backend>)
+      ->Apply(arguments)->Unit(benchmark::kMicrosecond);
+}
+
+//------------------------------------------------------------------------------
+// Reed-Solomon Erasure Code Benchmarks
+//------------------------------------------------------------------------------
+//
+// End-to-end systematic RS(k + m) over GF(2^8) and GF(2^16): encoding a stripe
+// and reconstructing it after the worst case of m lost data shards (matrix
+// inversion included). The same gfb::ReedSolomon codec runs on every backend
+// through the field adapters above. Arguments are {w, k, m, shard bytes, matrix};
+// bytes_per_second counts the k data shards of a stripe, so MB/s is directly
+// the encode or reconstruct rate of user data. Shards hold elements in each
+// backend's native representation; byte conversion is not timed.
+
+// {data shards, parity shards}
+const std::vector<std::pair<int64_t, int64_t>> RS_CONFIGS = {
+    {4, 2}, {6, 3}, {10, 4}, {16, 4}};
+const std::vector<int64_t> RS_SHARD_BYTES = {4 << 10, 64 << 10, 1 << 20};
+
+// Three 1 MiB-shard stripes of NTL::GF2E handles do not fit comfortably in
+// memory (see BULK_MAX_NTL_ELEMENTS); NTL stops at 64 KiB shards.
+const int64_t RS_MAX_NTL_SHARD_BYTES = 64 << 10;
+
+static void RSArgumentsUpTo(benchmark::internal::Benchmark *b,
+                            int64_t max_shard_bytes) {
+  for (int64_t w : {8, 16}) {
+    for (const auto &[k, m] : RS_CONFIGS) {
+      for (int64_t bytes : RS_SHARD_BYTES) {
+        if (bytes > max_shard_bytes) continue;
+        for (gfb::RSMatrix matrix :
+             {gfb::RSMatrix::kVandermonde, gfb::RSMatrix::kCauchy}) {
+          b->Args({w, k, m, bytes, static_cast<int64_t>(matrix)});
+        }
+      }
+    }
+  }
+}
+
+static void RSArguments(benchmark::internal::Benchmark *b) {
+  RSArgumentsUpTo(b, RS_SHARD_BYTES.back());
+}
+
+static void RSNTLArguments(benchmark::internal::Benchmark *b) {
+  RSArgumentsUpTo(b, RS_MAX_NTL_SHARD_BYTES);
+}
+
+// One stripe of k + m shards; data shards filled with the region values for w
+template <typename Field>
+std::vector<std::vector<typename Field::Element>>
+GenerateRSStripe(const Field &field, uint8_t w, size_t shards, size_t symbols) {
+  std::vector<std::vector<typename Field::Element>> stripe(shards);
+  for (size_t i = 0; i < shards; ++i) {
+    stripe[i].resize(symbols);
+    std::vector<uint32_t> values =
+        GenerateRandomRegionValues(symbols, w, static_cast<uint32_t>(42 + i));
+    for (size_t s = 0; s < symbols; ++s) {
+      field.Init(stripe[i][s], values[s]);
+    }
+  }
+  return stripe;
+}
+
+static void SetRSCounters(benchmark::State &state, size_t k, size_t m,
+                          size_t shard_bytes, gfb::RSMatrix matrix,
+                          size_t erased) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(k * shard_bytes));
+  state.counters["DataShards"] = k;
+  state.counters["ParityShards"] = m;
+  state.counters["ShardBytes"] = shard_bytes;
+  state.counters["ErasedShards"] = erased;
+  state.SetLabel(gfb::RSMatrixName(matrix));
+}
+
+template <typename Field>
+static void RSEncode(benchmark::State &state, const Field &field) {
+  uint8_t w = static_cast<uint8_t>(state.range(0));
+  size_t k = static_cast<size_t>(state.range(1));
+  size_t m = static_cast<size_t>(state.range(2));
+  size_t shard_bytes = static_cast<size_t>(state.range(3));
+  auto matrix = static_cast<gfb::RSMatrix>(state.range(4));
+  size_t symbols = shard_bytes / (w / 8);
+
+  gfb::ReedSolomon<Field> codec(field, k, m, matrix);
+  auto stripe = GenerateRSStripe(field, w, k + m, symbols);
+  std::vector<const typename Field::Element *> data;
+  std::vector<typename Field::Element *> parity;
+  for (size_t i = 0; i < k; ++i) data.push_back(stripe[i].data());
+  for (size_t i = k; i < k + m; ++i) parity.push_back(stripe[i].data());
+
+  for (auto _ : WithPerfCounters(state)) {
+    codec.Encode(data.data(), parity.data(), symbols);
+    benchmark::ClobberMemory();
+  }
+
+  SetRSCounters(state, k, m, shard_bytes, matrix, 0);
+}
+
+// Worst case: the first m data shards are lost, so the decoder inverts a
+// k x k matrix with m parity rows and rebuilds m full shards
+template <typename Field>
+static void RSReconstruct(benchmark::State &state, const Field &field) {
+  uint8_t w = static_cast<uint8_t>(state.range(0));
+  size_t k = static_cast<size_t>(state.range(1));
+  size_t m = static_cast<size_t>(state.range(2));
+  size_t shard_bytes = static_cast<size_t>(state.range(3));
+  auto matrix = static_cast<gfb::RSMatrix>(state.range(4));
+  size_t symbols = shard_bytes / (w / 8);
+  size_t erased = std::min(k, m);
+
+  gfb::ReedSolomon<Field> codec(field, k, m, matrix);
+  auto stripe = GenerateRSStripe(field, w, k + m, symbols);
+  std::vector<typename Field::Element *> shards;
+  for (auto &shard : stripe) shards.push_back(shard.data());
+  codec.Encode(shards.data(), shards.data() + k, symbols);
+
+  auto original = stripe;
+  std::vector<bool> present(k + m, true);
+  typename Field::Element zero;
+  field.Init(zero, 0);
+  for (size_t i = 0; i < erased; ++i) {
+    present[i] = false;
+    std::fill(stripe[i].begin(), stripe[i].end(), zero);
+  }
+
+  // One untimed pass to check the decoder before measuring it
+  codec.Reconstruct(shards.data(), present, symbols);
+  if (stripe != original) {
+    state.SkipWithError("Reed-Solomon reconstruction mismatch");
+    return;
+  }
+
+  for (auto _ : WithPerfCounters(state)) {
+    codec.Reconstruct(shards.data(), present, symbols);
+    benchmark::ClobberMemory();
+  }
+
+  SetRSCounters(state, k, m, shard_bytes, matrix, erased);
+}
+
+static void BM_Givaro_RSEncode(benchmark::State &state) {
+  GivaroFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSEncode(state, field);
+}
+
+static void BM_Givaro_RSReconstruct(benchmark::State &state) {
+  GivaroFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSReconstruct(state, field);
+}
+
+static void BM_Xgalois_RSEncode(benchmark::State &state) {
+  XgaloisFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSEncode(state, field);
+}
+
+static void BM_Xgalois_RSReconstruct(benchmark::State &state) {
+  XgaloisFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSReconstruct(state, field);
+}
+
+static void BM_NTL_RSEncode(benchmark::State &state) {
+  NTLFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSEncode(state, field);
+}
+
+static void BM_NTL_RSReconstruct(benchmark::State &state) {
+  NTLFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RSReconstruct(state, field);
+}
+
+static void BM_Zech_RSEncode(benchmark::State &state) {
+  ZechFieldAdapter<uint16_t> field(static_cast<uint8_t>(state.range(0)));
+  RSEncode(state, field);
+}
+
+static void BM_Zech_RSReconstruct(benchmark::State &state) {
+  ZechFieldAdapter<uint16_t> field(static_cast<uint8_t>(state.range(0)));
+  RSReconstruct(state, field);
+}
+
+//------------------------------------------------------------------------------
+// Multi-threaded Scaling Benchmarks
+//------------------------------------------------------------------------------
+//
+// Per-op throughput from 1 thread up to all hardware threads, with the field
+// either shared read-only by every thread or built separately in each
+// thread. Shared tables cost no memory per thread but every core reads the
+// same lines; private tables multiply the footprint by the thread count.
+// NTL keeps its modulus in a thread-local GF2E context, so each thread
+// installs its adapter's through NTLFieldAdapter::ThreadScope before
+// touching elements. BM_<backend>_Threaded/<op> takes {m, context};
+// BM_<backend>_ThreadedBulkMultiplication runs the bulk body with per-thread
+// fields and buffers over {m, n}. Timings use real time, so
+// items_per_second is the aggregate rate across threads. Operands are
+// seeded per thread. The sweep covers the per-op and bulk multiplication
+// bodies of the four library-comparison backends.
+
+enum class ThreadContext { kShared, kPerThread };
+
+const char *ThreadContextName(ThreadContext context) {
+  return context == ThreadContext::kShared ? "shared" : "per-thread";
+}
+
+const int MAX_BENCHMARK_THREADS =
+    static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+static void ThreadArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    for (ThreadContext context :
+         {ThreadContext::kShared, ThreadContext::kPerThread}) {
+      b->Args({m, static_cast<int64_t>(context)});
+    }
+  }
+}
+
+// Bulk multiplication scaling; per-thread buffers stop at 1M elements
+static void BulkThreadArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    for (int64_t n = BULK_MIN_ELEMENTS; n <= (1 << 20); n *= 32) {
+      b->Args({m, n});
+    }
+  }
+}
+
+// Field instances shared by all threads of a benchmark, built on first use
+// and kept for the rest of the run
+template <typename Field> class SharedFieldCache {
+public:
+  template <typename Factory> const Field &Get(uint8_t m, Factory make) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Field> &field = fields_[m];
+    if (!field) field = make();
+    return *field;
+  }
+
+private:
+  std::mutex mutex_;
+  std::map<uint8_t, std::unique_ptr<Field>> fields_;
+};
+
+static void SetThreadCounters(benchmark::State &state, ThreadContext context,
+                              double field_order) {
+  state.SetItemsProcessed(state.iterations());
+  state.counters["FieldOrder"] =
+      benchmark::Counter(field_order, benchmark::Counter::kAvgThreads);
+  state.counters["SharedTables"] = benchmark::Counter(
+      context == ThreadContext::kShared, benchmark::Counter::kAvgThreads);
+  state.SetLabel(ThreadContextName(context));
+}
+
+// The adapter for degree m shared by every thread of every benchmark that
+// asks for it, built on first use
+template <typename Adapter> const Adapter &SharedFieldAdapter(uint8_t m) {
+  static SharedFieldCache<Adapter> shared;
+  return shared.Get(m, [m] { return std::make_unique<Adapter>(m); });
+}
+
+template <typename Backend, FieldOp Op>
+static void BM_FieldThreaded(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto context = static_cast<ThreadContext>(state.range(1));
+
+  auto run = [&]<FieldBackend Field>(const Field &field) {
+    AdapterThreadScope<Field> scope(field);
+    auto elements = GenerateRandomAdapterElements(field, PER_OP_STREAM,
+                                                  42 + state.thread_index());
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      typename Field::Element result;
+      ApplyFieldOp<Op>(field, result, elements[idx % elements.size()],
+                       elements[(idx + 1) % elements.size()]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+
+    SetThreadCounters(state, context, static_cast<double>(field.Order()));
+    if constexpr (TableFieldBackend<Field>) {
+      state.counters["TableBytes"] = benchmark::Counter(
+          static_cast<double>(field.TableBytes()), benchmark::Counter::kAvgThreads);
+    }
+  };
+
+  if (context == ThreadContext::kPerThread) {
+    WithFieldBackend<Backend>(m, run);
+  } else {
+    WithFieldBackendType<Backend>(m, [&]<typename Field>(std::type_identity<Field>) {
+      run(SharedFieldAdapter<Field>(m));
+    });
+  }
+}
+
+// Registers BM_<backend>_Threaded/<op> over {m, context} and
+// BM_<backend>_ThreadedBulkMultiplication over {m, n}, each from one thread
+// to all hardware threads
+template <typename Backend> static void RegisterThreadedBenchmarks() {
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_Threaded";
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    benchmark::RegisterBenchmark((prefix + "/" + FieldOpName(Op)).c_str(),
+                                 BM_FieldThreaded<Backend, Op>)
+        ->Apply(ThreadArguments)->ThreadRange(1, MAX_BENCHMARK_THREADS)->UseRealTime();
+  });
+  benchmark::RegisterBenchmark((prefix + "BulkMultiplication").c_str(),
+                               BM_FieldBulk<Backend, FieldOp::kMultiplication>)
+      ->Apply(BulkThreadArguments)->ThreadRange(1, MAX_BENCHMARK_THREADS)
+      ->UseRealTime()->Unit(benchmark::kMicrosecond);
+}
+
+//------------------------------------------------------------------------------
+// Latency and Throughput Benchmarks
+//------------------------------------------------------------------------------
+//
+// Each op in two explicit modes over the same operand stream:
+//  - latency: one dependency chain, every result is an input of the next op
+//    (inversion chains x = 1/x), so out-of-order execution cannot overlap
+//    them and the time per op is the true latency;
+//  - throughput: LATENCY_ACCUMULATORS independent chains interleaved in an
+//    unrolled loop (inversion writes each result to its own slot), which
+//    keeps enough ops in flight to saturate the execution units.
+// One iteration runs LATENCY_CHAIN_LENGTH ops through the field adapters;
+// every result passes through DoNotOptimize so the compiler can neither
+// fold an addition chain into a vectorized reduction nor drop dead ops.
+// Arguments are {m}; TimePerOp is the wall time of a single op in either mode.
+
+const size_t LATENCY_CHAIN_LENGTH = 4096;
+const size_t LATENCY_ACCUMULATORS = 8;
+
+static void LatencyArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    b->Args({m});
+  }
+}
+
+static void SetLatencyCounters(benchmark::State &state, uint8_t m,
+                               const char *mode) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(LATENCY_CHAIN_LENGTH));
+  state.counters["FieldDegree"] = m;
+  state.counters["TimePerOp"] = benchmark::Counter(
+      static_cast<double>(LATENCY_CHAIN_LENGTH),
+      benchmark::Counter::kIsIterationInvariantRate |
+          benchmark::Counter::kInvert);
+  state.SetLabel(mode);
+}
+
+template <FieldOp Op, typename Field>
+static void RunLatency(benchmark::State &state, const Field &field) {
+  using Element = typename Field::Element;
+  auto operands = GenerateRandomAdapterElements(field, LATENCY_CHAIN_LENGTH);
+  Element x = operands[0];
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < LATENCY_CHAIN_LENGTH; ++i) {
+      ApplyFieldOp<Op>(field, x, x, operands[i]);
+      benchmark::DoNotOptimize(x);
+    }
+  }
+
+  SetLatencyCounters(state, static_cast<uint8_t>(state.range(0)), "latency");
+}
+
+template <FieldOp Op, typename Field>
+static void RunThroughput(benchmark::State &state, const Field &field) {
+  using Element = typename Field::Element;
+  constexpr size_t kLanes = LATENCY_ACCUMULATORS;
+  auto operands = GenerateRandomAdapterElements(field, LATENCY_CHAIN_LENGTH);
+  std::array<Element, kLanes> acc;
+  for (size_t j = 0; j < kLanes; ++j) acc[j] = operands[j];
+  std::vector<Element> results(LATENCY_CHAIN_LENGTH);
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < LATENCY_CHAIN_LENGTH; i += kLanes) {
+      if constexpr (Op == FieldOp::kInversion) {
+        for (size_t j = 0; j < kLanes; ++j) {
+          field.Inv(results[i + j], operands[i + j]);
+        }
+      } else {
+        for (size_t j = 0; j < kLanes; ++j) {
+          ApplyFieldOp<Op>(field, acc[j], acc[j], operands[i + j]);
+          benchmark::DoNotOptimize(acc[j]);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+
+  SetLatencyCounters(state, static_cast<uint8_t>(state.range(0)), "throughput");
+}
+
+template <typename Backend, FieldOp Op>
+static void BM_FieldLatency(benchmark::State &state) {
+  WithFieldBackend<Backend>(
+      static_cast<uint8_t>(state.range(0)),
+      [&](const FieldBackend auto &field) { RunLatency<Op>(state, field); });
+}
+
+template <typename Backend, FieldOp Op>
+static void BM_FieldThroughput(benchmark::State &state) {
+  WithFieldBackend<Backend>(
+      static_cast<uint8_t>(state.range(0)),
+      [&](const FieldBackend auto &field) { RunThroughput<Op>(state, field); });
+}
+
+// Registers BM_<backend>_Latency/<op> and BM_<backend>_Throughput/<op>
+template <typename Backend> static void RegisterLatencyBenchmarks() {
+  const std::string prefix = std::string("BM_") + Backend::Name();
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    benchmark::RegisterBenchmark(
+        (prefix + "_Latency/" + FieldOpName(Op)).c_str(),
+        BM_FieldLatency<Backend, Op>)
+        ->Apply(LatencyArguments)->Unit(benchmark::kNanosecond);
+  });
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    benchmark::RegisterBenchmark(
+        (prefix + "_Throughput/" + FieldOpName(Op)).c_str(),
+        BM_FieldThroughput<Backend, Op>)
+        ->Apply(LatencyArguments)->Unit(benchmark::kNanosecond);
+  });
+}
+
+//------------------------------------------------------------------------------
+// Working-set and Cache-pressure Benchmarks
+//------------------------------------------------------------------------------
+//
+// Table-based backends (Givaro GFq, xgalois GF2XZECH, gfb Zech) for m = 8..24,
+// with operands drawn from the first n nonzero field values in one of three
+// access patterns over the polynomial representation:
+//  - sequential: 1, 2, ..., n, wrapping around;
+//  - strided: about CACHE_STRIDE values apart modulo n (see CacheStride),
+//    so consecutive operands land on different cache lines and, for large
+//    n, different pages;
+//  - random: uniform over [1, n]; n = 2^m - 1 is the whole field.
+// Log-representation backends index their tables by discrete log, which
+// scatters even sequential values; that is part of what is measured.
+// Each iteration runs one independent op per operand pair over a stream of at
+// least CACHE_MIN_STREAM pairs, and never fewer than n, so the tables are
+// not re-warmed by a short stream replaying the same entries. Arguments are
+// {m, pattern, n}; compare TimePerOp against TableBytes to find the point
+// where each backend falls off L1, L2, LLC and TLB reach.
+
+enum class AccessPattern { kSequential, kStrided, kRandom };
+
+const char *AccessPatternName(AccessPattern pattern) {
+  switch (pattern) {
+    case AccessPattern::kSequential: return "sequential";
+    case AccessPattern::kStrided: return "strided";
+    default: return "random";
+  }
+}
+
+const std::vector<uint8_t> CACHE_DEGREES = {8, 10, 12, 14, 16, 18, 20, 22, 24};
+const uint32_t CACHE_MIN_WORKING_SET = 1 << 10;
+const size_t CACHE_MIN_STREAM = 1 << 16;
+// Preferred stride, a prime a little over one 4 KiB page of 1-byte entries
+const uint32_t CACHE_STRIDE = 4099;
+// Values in one 64-byte cache line of the narrowest (1-byte) table entries
+const uint32_t CACHE_MIN_STRIDE = 64;
+
+// Stride for a working set of n values: CACHE_STRIDE mod n, raised to at
+// least CACHE_MIN_STRIDE so consecutive operands never share a line, then
+// to the next odd value coprime to n so the walk visits all n values. The
+// working set n = 1K gives 65 rather than 4099 mod 1K = 3.
+uint32_t CacheStride(uint32_t n) {
+  uint32_t step = std::max(CACHE_STRIDE % n, CACHE_MIN_STRIDE) | 1;
+  while (std::gcd(step, n) != 1) step += 2;
+  return step % n;
+}
+
+// Working sets grow 16x from 1K values; the whole field is always included
+static void CacheArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CACHE_DEGREES) {
+    const int64_t nonzero = (int64_t{1} << m) - 1;
+    for (AccessPattern pattern : {AccessPattern::kSequential,
+                                  AccessPattern::kStrided,
+                                  AccessPattern::kRandom}) {
+      for (int64_t n = CACHE_MIN_WORKING_SET; n < nonzero; n *= 16) {
+        b->Args({m, static_cast<int64_t>(pattern), n});
+      }
+      b->Args({m, static_cast<int64_t>(pattern), nonzero});
+    }
+  }
+}
+
+// Polynomial values in [1, n] visited in the given pattern
+std::vector<uint32_t> GenerateAccessPattern(AccessPattern pattern, uint32_t n,
+                                            size_t count, uint32_t seed = 42) {
+  std::vector<uint32_t> values(count);
+  if (pattern == AccessPattern::kRandom) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint32_t> dis(1, n);
+    for (auto &v : values) v = dis(gen);
+    return values;
+  }
+
+  const uint32_t step = pattern == AccessPattern::kStrided ? CacheStride(n) : 1;
+  uint32_t offset = 0;
+  for (auto &v : values) {
+    v = offset + 1;
+    offset += step;
+    if (offset >= n) offset -= n;
+  }
+  return values;
+}
+
+template <FieldOp Op, typename Field>
+static void RunCacheSweep(benchmark::State &state, const Field &field) {
+  using Element = typename Field::Element;
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto pattern = static_cast<AccessPattern>(state.range(1));
+  uint32_t n = static_cast<uint32_t>(state.range(2));
+  size_t count = std::max<size_t>(CACHE_MIN_STREAM, n);
+
+  // b is the same stream rotated by half, so both operands follow the pattern
+  std::vector<uint32_t> values = GenerateAccessPattern(pattern, n, count);
+  std::vector<Element> a(count);
+  std::vector<Element> b(count);
+  for (size_t i = 0; i < count; ++i) {
+    field.Init(a[i], values[i]);
+    field.Init(b[i], values[(i + count / 2) % count]);
+  }
+
+  for (auto _ : WithPerfCounters(state)) {
+    for (size_t i = 0; i < count; ++i) {
+      Element result;
+      ApplyFieldOp<Op>(field, result, a[i], b[i]);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(count));
+  state.counters["FieldDegree"] = m;
+  state.counters["WorkingSet"] = n;
+  state.counters["TableBytes"] = benchmark::Counter(
+      static_cast<double>(field.TableBytes()), benchmark::Counter::kDefaults,
+      benchmark::Counter::kIs1024);
+  state.counters["TimePerOp"] = benchmark::Counter(
+      static_cast<double>(count),
+      benchmark::Counter::kIsIterationInvariantRate |
+          benchmark::Counter::kInvert);
+  state.SetLabel(AccessPatternName(pattern));
+}
+
+template <typename OpTag>
+static void BM_Givaro_CacheSweep(benchmark::State &state, OpTag) {
+  GivaroFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RunCacheSweep<OpTag::value>(state, field);
+}
+
+template <typename OpTag>
+static void BM_Xgalois_CacheSweep(benchmark::State &state, OpTag) {
+  XgaloisFieldAdapter field(static_cast<uint8_t>(state.range(0)));
+  RunCacheSweep<OpTag::value>(state, field);
+}
+
+template <typename OpTag>
+static void BM_Zech_CacheSweep(benchmark::State &state, OpTag) {
+  WithFieldBackend<ZechBackend>(static_cast<uint8_t>(state.range(0)),
+                                [&](const auto &field) { RunCacheSweep<OpTag::value>(state, field); });
+}
+
+//------------------------------------------------------------------------------
+// Table Layout Benchmarks
+//------------------------------------------------------------------------------
+//
+// The same fields in smaller table layouts, to weigh ns/op against bytes:
+//  - entry width: uint32_t against uint16_t entries (m <= 16);
+//  - Zech: the full Zech table against the half one that derives the upper
+//    half from Z(d) = d + Z(-d) (GF2mZech<IndexT, ZechLayout::kHalf>);
+//  - Log, polynomial basis (gfb/field/gf2m_log.hpp): separate log and
+//    doubled antilog tables against one interleaved {log, antilog} array.
+// Each variant runs the cache sweep's random pattern over the whole field,
+// so TimePerOp is comparable with BM_*_CacheSweep, and also reports the
+// measured heap footprint of one instance. Addition exercises the Zech
+// table and multiplication the log/antilog tables; the polynomial-basis Log
+// fields add by XOR without touching a table, so they run multiplication
+// only. Arguments are {m, pattern, n} as in the sweep, with pattern random
+// and n = 2^m - 1.
+
+const std::vector<uint8_t> TABLE_LAYOUT_DEGREES = {8, 12, 16, 20, 24};
+
+static void TableLayoutArguments(benchmark::internal::Benchmark *b,
+                                 uint8_t max_degree) {
+  for (uint8_t m : TABLE_LAYOUT_DEGREES) {
+    if (m > max_degree) continue;
+    b->Args({m, static_cast<int64_t>(AccessPattern::kRandom),
+             (int64_t{1} << m) - 1});
+  }
+}
+
+// Whether Add reads the tables, and so belongs in a layout comparison
+template <typename Adapter> constexpr bool kAdditionReadsTables = true;
+template <typename IndexT, gfb::LogLayout Layout>
+constexpr bool kAdditionReadsTables<LogFieldAdapter<IndexT, Layout>> = false;
 
-MemoryUsage GetMemoryUsage() {
-  MemoryUsage usage;
+template <typename Adapter, FieldOp Op>
+static void BM_TableLayout(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  Adapter field(m);
+  RunCacheSweep<Op>(state, field);
+  SetMemoryCounters(state, Adapter::MeasureFootprint(m));
+}
 
-  // Get peak memory usage
-  struct rusage rusage_data;
-  if (getrusage(RUSAGE_SELF, &rusage_data) == 0) {
-    usage.peak_rss_kb = rusage_data.ru_maxrss / 1024; // Convert to KB on macOS
+// Registers BM_TableLayout_<backend><bits>/{Addition,Multiplication}, the
+// former only where addition reads the tables
+template <typename Adapter> static void RegisterTableLayoutBenchmarks() {
+  using Element = typename Adapter::Element;
+  const uint8_t max_degree = sizeof(Element) * 8 < 24 ? sizeof(Element) * 8 : 24;
+  const std::string prefix = std::string("BM_TableLayout_") + Adapter::Name() +
+                             std::to_string(sizeof(Element) * 8) + "/";
+  auto add = [max_degree](const std::string &name, auto fn) {
+    auto *b = benchmark::RegisterBenchmark(name.c_str(), fn)->Unit(benchmark::kMicrosecond);
+    TableLayoutArguments(b, max_degree);
+  };
+  if constexpr (kAdditionReadsTables<Adapter>) {
+    add(prefix + "Addition", BM_TableLayout<Adapter, FieldOp::kAddition>);
   }
+  add(prefix + "Multiplication", BM_TableLayout<Adapter, FieldOp::kMultiplication>);
+}
 
-  // Get current memory usage using ps command (macOS compatible)
-  pid_t pid = getpid();
-  char command[256];
-  snprintf(command, sizeof(command), "ps -o rss= -p %d", pid);
+//------------------------------------------------------------------------------
+// Tower Field Benchmarks
+//------------------------------------------------------------------------------
+//
+// gfb::GF2mTower (gfb/field/gf2m_tower.hpp) builds GF(2^16) and GF(2^32) as
+// quadratic extensions over GF(2^8), so every product is a handful of
+// lookups into 766 bytes of GF(2^8) tables instead of one lookup into
+// 2^m-entry tables. The tower joins the matrix where the table backends
+// already run, to show whether L1-resident tables beat large direct ones:
+//  - per-op: BM_Tower_<op>/Medium/16 and /Large/32, beside the other
+//    backends' per-degree benchmarks;
+//  - bulk: BM_Tower_Bulk<op> with {m, n} for m = 16, 32, with CLMUL over
+//    the same arguments as the table-free baseline at m = 32, where no
+//    direct table fits;
+//  - cache pressure: BM_Tower_CacheSweep with {m, pattern, n} as in
+//    BM_*_CacheSweep, m = 16 up to the whole field and m = 32 up to 16M
+//    working-set values.
+// Operands are the shared corpus values mapped into the tower basis.
+
+const std::vector<uint8_t> TOWER_DEGREES = {16, 32};
+const int64_t TOWER_MAX_WORKING_SET = int64_t{1} << 24;
+
+static void TowerBulkArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : TOWER_DEGREES) {
+    for (int64_t n = BULK_MIN_ELEMENTS; n <= BULK_MAX_ELEMENTS; n *= 4) {
+      b->Args({m, n});
+    }
+  }
+}
 
-  FILE *pipe = popen(command, "r");
-  if (pipe) {
-    char buffer[128];
-    if (fgets(buffer, sizeof(buffer), pipe)) {
-      usage.current_rss_kb = atol(buffer);
+static void TowerCacheArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : TOWER_DEGREES) {
+    const int64_t nonzero = (int64_t{1} << m) - 1;
+    for (AccessPattern pattern : {AccessPattern::kSequential,
+                                  AccessPattern::kStrided,
+                                  AccessPattern::kRandom}) {
+      for (int64_t n = CACHE_MIN_WORKING_SET;
+           n < nonzero && n <= TOWER_MAX_WORKING_SET; n *= 16) {
+        b->Args({m, static_cast<int64_t>(pattern), n});
+      }
+      if (nonzero <= TOWER_MAX_WORKING_SET) {
+        b->Args({m, static_cast<int64_t>(pattern), nonzero});
+      }
     }
-    pclose(pipe);
   }
+}
 
-  return usage;
+template <typename OpTag>
+static void BM_Tower_CacheSweep(benchmark::State &state, OpTag) {
+  WithFieldBackend<TowerBackend>(static_cast<uint8_t>(state.range(0)),
+                                 [&](const auto &field) { RunCacheSweep<OpTag::value>(state, field); });
 }
-//------------------------------------------------------------------------------
-// Field Sizes for Testing
-//------------------------------------------------------------------------------
 
-// Field degrees to test
-const std::vector<uint8_t> FIELD_DEGREES = {4, 8, 12, 16, 20};
+// Registers BM_Tower_<op>/<tier> for m = 16 and 32
+static void RegisterTowerOpBenchmarks() {
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    const std::string name = std::string("BM_Tower_") + FieldOpName(Op) + "/";
+    for (uint8_t m : TOWER_DEGREES) {
+      benchmark::RegisterBenchmark((name + DegreeTier(m)).c_str(),
+                                   BM_FieldOp<TowerBackend, Op>)
+          ->Arg(m)->Unit(benchmark::kNanosecond);
+    }
+  });
+}
 
 //------------------------------------------------------------------------------
-// Helper Functions
+// Normal Basis Benchmarks
 //------------------------------------------------------------------------------
-
-template <typename ElementType>
-std::vector<typename Givaro::GFq<ElementType>::Element>
-GenerateRandomGivaroElements(const Givaro::GFq<ElementType> &field, size_t count,
-                            uint32_t seed = 42) {
-  std::mt19937 gen(seed);
-  std::uniform_int_distribution<uint32_t> dis(
-      1, static_cast<uint32_t>(field.cardinality() - 1)); // Start from 1 to avoid zero
-
-  std::vector<typename Givaro::GFq<ElementType>::Element> elements;
-  elements.reserve(count);
-
-  for (size_t i = 0; i < count; ++i) {
-    typename Givaro::GFq<ElementType>::Element elem;
-    uint32_t val = dis(gen);
-    // Ensure we never get zero
-    if (val == 0) val = 1;
-    field.init(elem, val);
-    elements.push_back(elem);
+//
+// gfb::GF2mNormal (gfb/field/gf2m_normal.hpp) works in a Gaussian normal
+// basis, where squaring and square roots are one-bit rotations and
+// multiplication is Massey-Omura, with a cost growing with the basis type.
+// Square and square root are registered for every backend as
+//   BM_<backend>_Square/<tier>/<m> and BM_<backend>_SquareRoot/<tier>/<m>;
+// backends without their own squaring multiply a by itself, and take the
+// square root as a^(2^(m-1)), m - 1 squarings. The normal basis also runs
+// the four per-op benchmarks as BM_Normal_<op>/<tier>/<m>, to set the
+// cheap squarings against its dearer products and inversions.
+//
+// Degrees divisible by 8 have no Gaussian normal basis, so the sweep is
+// FIELD_DEGREES without 8 and 16, plus larger degrees up to the end of the
+// shared modulus list: types 2 (23, 29), 1 (28) and 10 (31).
+
+const std::vector<uint8_t> NORMAL_DEGREES = {4, 12, 20, 23, 28, 29, 31};
+
+enum class SquareOp { kSquare, kSquareRoot };
+
+// r = a^2, through the backend's own squaring where it has one
+template <FieldBackend Field>
+inline void ApplySquare(const Field &field, typename Field::Element &r,
+                        const typename Field::Element &a) {
+  if constexpr (requires { field.Square(r, a); }) {
+    field.Square(r, a);
+  } else {
+    field.Mul(r, a, a);
   }
+}
 
-  return elements;
+// r = a^(1/2) = a^(2^(m-1)), through the backend's own square root where it
+// has one
+template <FieldBackend Field>
+inline void ApplySqrt(const Field &field, uint8_t m, typename Field::Element &r,
+                      const typename Field::Element &a) {
+  if constexpr (requires { field.Sqrt(r, a); }) {
+    field.Sqrt(r, a);
+  } else {
+    r = a;
+    for (uint8_t i = 1; i < m; ++i) ApplySquare(field, r, r);
+  }
 }
 
-std::vector<uint32_t> GenerateRandomXgaloisElements(const xg::GF2XZECH &field,
-                                                   size_t count,
-                                                   uint32_t seed = 42) {
-  std::mt19937 gen(seed);
-  std::uniform_int_distribution<uint32_t> dis(1, field.Order() - 1); // Start from 1 to avoid zero
+template <typename Backend, SquareOp Op>
+static void BM_FieldSquare(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    auto elements = GenerateRandomAdapterElements(field, PER_OP_STREAM);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      typename Field::Element result;
+      if constexpr (Op == SquareOp::kSquare) {
+        ApplySquare(field, result, elements[idx % elements.size()]);
+      } else {
+        ApplySqrt(field, m, result, elements[idx % elements.size()]);
+      }
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
 
-  std::vector<uint32_t> elements;
-  elements.reserve(count);
+    SetMemoryCounters(state, Field::MeasureFootprint(m));
+    state.counters["FieldOrder"] = static_cast<double>(field.Order());
+    if constexpr (TableFieldBackend<Field>) {
+      state.counters["TableBytes"] = static_cast<double>(field.TableBytes());
+    }
+  });
+}
 
-  for (size_t i = 0; i < count; ++i) {
-    uint32_t val = dis(gen);
-    // Ensure we never get zero (additional safety check)
-    if (val == 0) val = 1;
-    elements.push_back(val);
-  }
+// Registers BM_<backend>_Square and BM_<backend>_SquareRoot over the
+// NORMAL_DEGREES up to max_degree
+template <typename Backend> static void RegisterSquareBenchmarks(uint8_t max_degree) {
+  const std::vector<uint8_t> degrees = DegreesUpTo(NORMAL_DEGREES, max_degree);
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_";
+  RegisterDegrees((prefix + "Square").c_str(), BM_FieldSquare<Backend, SquareOp::kSquare>,
+                  degrees);
+  RegisterDegrees((prefix + "SquareRoot").c_str(),
+                  BM_FieldSquare<Backend, SquareOp::kSquareRoot>, degrees);
+}
 
-  return elements;
+// Registers BM_Normal_<op>/<tier> over NORMAL_DEGREES
+static void RegisterNormalOpBenchmarks() {
+  ForEachFieldOp([&](auto op) {
+    constexpr FieldOp Op = decltype(op)::value;
+    const std::string name = std::string("BM_Normal_") + FieldOpName(Op);
+    RegisterDegrees(name.c_str(), BM_FieldOp<NormalFieldAdapter, Op>, NORMAL_DEGREES);
+  });
 }
 
-std::vector<NTL::GF2E> GenerateRandomNTLElements(size_t count, uint32_t seed = 42) {
-  std::mt19937 gen(seed);
-  std::uniform_int_distribution<uint32_t> dis(1, (1 << NTL::GF2E::degree()) - 1); // Start from 1 to avoid zero
+//------------------------------------------------------------------------------
+// Trace and Quadratic Solver Benchmarks
+//------------------------------------------------------------------------------
+//
+// The absolute trace, the half-trace (odd m) and solving z^2 + z = c, as
+// used in binary-curve point decompression, in two families (see
+// gfb/field/gf2m_trace.hpp):
+//  - gfb::TraceArith with each backend's own arithmetic, a chain of about m
+//    squarings, plus a multiplication per step when solving for even m,
+//    except that the normal basis takes the trace and solve natively:
+//    BM_<backend>_{Trace,HalfTrace,QuadraticSolve}/<tier>/<m>;
+//  - gfb::GF2mTraceMap, the same three as precomputed linear maps of
+//    polynomial-basis values, applied per set bit or per byte:
+//    BM_TraceMap{Matrix,Table}_{Trace,HalfTrace,QuadraticSolve}/<tier>/<m>.
+// QuadraticSolve operands are c = e^2 + e, so every equation has a
+// solution. The degrees are FIELD_DEGREES plus odd degrees for the
+// half-trace; the normal basis skips multiples of 8.
+
+const std::vector<uint8_t> TRACE_DEGREES = {4, 8, 9, 12, 13, 16, 17, 20, 23, 29};
+const std::vector<uint8_t> TRACE_NORMAL_DEGREES = {4, 9, 12, 13, 17, 20, 23, 29};
+
+enum class TraceOp { kTrace, kHalfTrace, kQuadraticSolve };
+
+const char *TraceOpName(TraceOp op) {
+  switch (op) {
+    case TraceOp::kTrace: return "Trace";
+    case TraceOp::kHalfTrace: return "HalfTrace";
+    default: return "QuadraticSolve";
+  }
+}
 
-  std::vector<NTL::GF2E> elements;
-  elements.reserve(count);
+// Calls fn(op) for each op, with the degrees of `degrees` it applies to
+template <typename Fn>
+void ForEachTraceOp(const std::vector<uint8_t> &degrees, Fn &&fn) {
+  std::vector<uint8_t> odd;
+  for (uint8_t m : degrees) {
+    if (m % 2 == 1) odd.push_back(m);
+  }
+  fn(std::integral_constant<TraceOp, TraceOp::kTrace>{}, degrees);
+  fn(std::integral_constant<TraceOp, TraceOp::kHalfTrace>{}, odd);
+  fn(std::integral_constant<TraceOp, TraceOp::kQuadraticSolve>{}, degrees);
+}
 
-  for (size_t i = 0; i < count; ++i) {
-    NTL::GF2X poly;
-    uint32_t val = dis(gen);
-    // Ensure we never get zero polynomial
-    if (val == 0) val = 1;
-
-    // Convert val to polynomial representation
-    for (int j = 0; j < NTL::GF2E::degree(); ++j) {
-      if ((val >> j) & 1) {
-        NTL::SetCoeff(poly, j, 1);
+template <typename Backend, TraceOp Op>
+static void BM_FieldTrace(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    gfb::TraceArith<Field> trace(field);
+    auto elements = GenerateRandomAdapterElements(field, PER_OP_STREAM);
+    if constexpr (Op == TraceOp::kQuadraticSolve) {
+      for (auto &e : elements) {
+        typename Field::Element square;
+        field.Mul(square, e, e);
+        field.Add(e, square, e);
+      }
+    }
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      typename Field::Element result;
+      const auto &a = elements[idx % elements.size()];
+      if constexpr (Op == TraceOp::kTrace) trace.Trace(result, a);
+      if constexpr (Op == TraceOp::kHalfTrace) trace.HalfTrace(result, a);
+      if constexpr (Op == TraceOp::kQuadraticSolve) {
+        benchmark::DoNotOptimize(trace.SolveQuadratic(result, a));
       }
+      benchmark::DoNotOptimize(result);
+      idx++;
     }
 
-    NTL::GF2E elem;
-    NTL::conv(elem, poly);
+    SetMemoryCounters(state, Field::MeasureFootprint(m));
+    state.counters["FieldOrder"] = static_cast<double>(field.Order());
+    if constexpr (TableFieldBackend<Field>) {
+      state.counters["TableBytes"] = static_cast<double>(field.TableBytes());
+    }
+  });
+}
 
-    // Double-check that we didn't create zero element
-    if (NTL::IsZero(elem)) {
-      NTL::SetCoeff(poly, 0, 1); // Set constant term to ensure non-zero
-      NTL::conv(elem, poly);
+template <gfb::TraceMapForm Form, TraceOp Op>
+static void BM_TraceMap(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  const uint64_t poly = GetModulus(m);
+  const gfb::GF2mTraceMap<Form> map(m, poly);
+  gfb::OperandCorpus corpus = GetOperandCorpus(m, PER_OP_STREAM, 42);
+  std::vector<uint32_t> operands(corpus.data(), corpus.data() + PER_OP_STREAM);
+  if constexpr (Op == TraceOp::kQuadraticSolve) {
+    for (auto &e : operands) {
+      e ^= static_cast<uint32_t>(gfb::MulModModulus(e, e, m, poly));
     }
+  }
+  size_t idx = 0;
 
-    elements.push_back(elem);
+  for (auto _ : WithPerfCounters(state)) {
+    uint32_t result;
+    const uint32_t a = operands[idx % operands.size()];
+    if constexpr (Op == TraceOp::kTrace) result = map.Trace(a);
+    if constexpr (Op == TraceOp::kHalfTrace) result = map.HalfTrace(a);
+    if constexpr (Op == TraceOp::kQuadraticSolve) {
+      benchmark::DoNotOptimize(map.SolveQuadratic(a, result));
+    }
+    benchmark::DoNotOptimize(result);
+    idx++;
   }
 
-  return elements;
+  state.counters["FieldOrder"] = static_cast<double>(uint64_t{1} << m);
+  state.counters["TableBytes"] = static_cast<double>(map.TableBytes());
 }
 
-// Helper function to get irreducible polynomial for each field size
-std::string GetIrreduciblePoly(uint8_t m) {
-  switch (m) {
-    case 4: return "x^4 + x + 1";
-    case 8: return "x^8 + x^4 + x^3 + x^2 + 1";
-    case 12: return "x^12 + x^6 + x^4 + x + 1";
-    case 16: return "x^16 + x^12 + x^3 + x + 1";
-    case 20: return "x^20 + x^3 + 1";
-    default: return ""; // Let the library choose
-  }
+// Registers BM_<backend>_<trace op>/<tier> over `degrees`
+template <typename Backend>
+static void RegisterTraceBenchmarks(const std::vector<uint8_t> &degrees) {
+  ForEachTraceOp(degrees, [](auto op, const std::vector<uint8_t> &op_degrees) {
+    constexpr TraceOp Op = decltype(op)::value;
+    const std::string name = std::string("BM_") + Backend::Name() + "_" + TraceOpName(Op);
+    RegisterDegrees(name.c_str(), BM_FieldTrace<Backend, Op>, op_degrees);
+  });
 }
 
-// Helper function to get NTL irreducible polynomial for each field size
-NTL::GF2X GetNTLIrreduciblePoly(uint8_t m) {
-  NTL::GF2X poly;
-  switch (m) {
-    case 4:
-      // x^4 + x + 1
-      NTL::SetCoeff(poly, 4); NTL::SetCoeff(poly, 1); NTL::SetCoeff(poly, 0);
-      break;
-    case 8:
-      // x^8 + x^4 + x^3 + x^2 + 1
-      NTL::SetCoeff(poly, 8); NTL::SetCoeff(poly, 4); NTL::SetCoeff(poly, 3); NTL::SetCoeff(poly, 2); NTL::SetCoeff(poly, 0);
-      break;
-    case 12:
-      // x^12 + x^6 + x^4 + x + 1
-      NTL::SetCoeff(poly, 12); NTL::SetCoeff(poly, 6); NTL::SetCoeff(poly, 4); NTL::SetCoeff(poly, 1); NTL::SetCoeff(poly, 0);
-      break;
-    case 16:
-      // x^16 + x^12 + x^3 + x + 1
-      NTL::SetCoeff(poly, 16); NTL::SetCoeff(poly, 12); NTL::SetCoeff(poly, 3); NTL::SetCoeff(poly, 1); NTL::SetCoeff(poly, 0);
-      break;
-    case 20:
-      // x^20 + x^3 + 1
-      NTL::SetCoeff(poly, 20); NTL::SetCoeff(poly, 3); NTL::SetCoeff(poly, 0);
-      break;
-    default:
-      // Default irreducible polynomial
-      NTL::SetCoeff(poly, m); NTL::SetCoeff(poly, 1); NTL::SetCoeff(poly, 0);
-      break;
+// Registers BM_TraceMap{Matrix,Table}_<trace op>/<tier> over TRACE_DEGREES
+static void RegisterTraceMapBenchmarks() {
+  ForEachTraceOp(TRACE_DEGREES, [](auto op, const std::vector<uint8_t> &op_degrees) {
+    constexpr TraceOp Op = decltype(op)::value;
+    RegisterDegrees((std::string("BM_TraceMapMatrix_") + TraceOpName(Op)).c_str(),
+                    BM_TraceMap<gfb::TraceMapForm::kMatrix, Op>, op_degrees);
+    RegisterDegrees((std::string("BM_TraceMapTable_") + TraceOpName(Op)).c_str(),
+                    BM_TraceMap<gfb::TraceMapForm::kTable, Op>, op_degrees);
+  });
+}
+
+//------------------------------------------------------------------------------
+// Field Construction Benchmarks
+//------------------------------------------------------------------------------
+//
+// What each process start pays per field: one iteration builds a field and
+// tears it down again (NTL: a GF2EContext, which holds the modulus tables).
+// BM_Zech_CachedConstruction opens the same tables from the on-disk cache
+// in gfb/field/gf2m_table_cache.hpp instead of generating them. It either
+// only maps the file ("mapped") or also reads one entry per page
+// ("mapped+touched"), which is the page-in cost of first use. The cache
+// file is written once per degree before timing. It normally stays in the
+// page cache, so cold-disk reads are not part of the measurement.
+// Arguments are {m} and, for the cache, {m, touch}.
+
+const std::vector<uint8_t> CONSTRUCTION_DEGREES = {4, 8, 12, 16, 20, 24};
+
+static void ConstructionArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CONSTRUCTION_DEGREES) {
+    b->Args({m});
   }
-  return poly;
 }
 
-// Helper function to get Givaro polynomial representation
-std::vector<int> GetGivaroIrreduciblePoly(uint8_t m) {
-  std::vector<int> poly;
-  switch (m) {
-    case 4:
-      // x^4 + x + 1
-      poly = {1, 1, 0, 0, 1}; // coefficients from x^0 to x^4
-      break;
-    case 8:
-      // x^8 + x^4 + x^3 + x^2 + 1
-      poly = {1, 0, 1, 1, 1, 0, 0, 0, 1}; // coefficients from x^0 to x^8
-      break;
-    case 12:
-      // x^12 + x^6 + x^4 + x + 1
-      poly = {1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1}; // coefficients from x^0 to x^12
-      break;
-    case 16:
-      // x^16 + x^12 + x^3 + x + 1
-      poly = {1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1}; // coefficients from x^0 to x^16
-      break;
-    case 20:
-      // x^20 + x^3 + 1
-      poly = {1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}; // coefficients from x^0 to x^20
-      break;
-    default:
-      // Default: x^m + x + 1
-      poly.resize(m + 1, 0);
-      poly[0] = 1; // constant term
-      poly[1] = 1; // x term
-      poly[m] = 1; // x^m term
-      break;
+static void CachedConstructionArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CONSTRUCTION_DEGREES) {
+    for (int64_t touch : {0, 1}) {
+      b->Args({m, touch});
+    }
   }
-  return poly;
 }
 
-//------------------------------------------------------------------------------
-// Givaro GFq Benchmarks
-//------------------------------------------------------------------------------
+// Per-user scratch location for the benchmark's table files
+std::string GetTableCacheDirectory() {
+  return (std::filesystem::temp_directory_path() / "gfb_table_cache").string();
+}
+
+static void SetConstructionCounters(benchmark::State &state, uint8_t m) {
+  state.counters["FieldDegree"] = m;
+  state.counters["FieldOrder"] = static_cast<double>(uint64_t{1} << m);
+}
 
-static void BM_Givaro_Addition(benchmark::State &state) {
+static void BM_Givaro_Construction(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
   std::vector<int> poly = GetGivaroIrreduciblePoly(m);
-  Givaro::GFq<int64_t> field(2, m, poly);
-
-  auto elements = GenerateRandomGivaroElements(field, 10000);
-  size_t idx = 0;
 
-  for (auto _ : state) {
-    Givaro::GFq<int64_t>::Element result;
-    field.add(result, elements[idx % elements.size()],
-              elements[(idx + 1) % elements.size()]);
-    benchmark::DoNotOptimize(result);
-    idx++;
+  for (auto _ : WithPerfCounters(state)) {
+    Givaro::GFq<int64_t> field(2, m, poly);
+    benchmark::DoNotOptimize(field);
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.cardinality();
+  SetConstructionCounters(state, m);
 }
 
-static void BM_Givaro_Multiplication(benchmark::State &state) {
+static void BM_Xgalois_Construction(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  std::vector<int> poly = GetGivaroIrreduciblePoly(m);
-  Givaro::GFq<int64_t> field(2, m, poly);
-
-  auto elements = GenerateRandomGivaroElements(field, 10000);
-  size_t idx = 0;
+  std::string poly = GetIrreduciblePoly(m);
 
-  for (auto _ : state) {
-    Givaro::GFq<int64_t>::Element result;
-    field.mul(result, elements[idx % elements.size()],
-              elements[(idx + 1) % elements.size()]);
-    benchmark::DoNotOptimize(result);
-    idx++;
+  for (auto _ : WithPerfCounters(state)) {
+    xg::GF2XZECH field(m, "log", poly);
+    benchmark::DoNotOptimize(field);
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.cardinality();
+  SetConstructionCounters(state, m);
 }
 
-static void BM_Givaro_Division(benchmark::State &state) {
+static void BM_NTL_Construction(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  std::vector<int> poly = GetGivaroIrreduciblePoly(m);
-  Givaro::GFq<int64_t> field(2, m, poly);
+  NTL::GF2X poly = GetNTLIrreduciblePoly(m);
 
-  auto elements = GenerateRandomGivaroElements(field, 10000);
-  size_t idx = 0;
+  for (auto _ : WithPerfCounters(state)) {
+    NTL::GF2EContext context(poly);
+    benchmark::DoNotOptimize(context);
+  }
 
-  for (auto _ : state) {
-    Givaro::GFq<int64_t>::Element result;
-    auto divisor = elements[(idx + 1) % elements.size()];
-    // Additional safety check to ensure divisor is not zero
-    if (field.isZero(divisor)) {
-      field.init(divisor, 1); // Set to 1 if somehow zero
-    }
-    field.div(result, elements[idx % elements.size()], divisor);
-    benchmark::DoNotOptimize(result);
-    idx++;
+  SetConstructionCounters(state, m);
+}
+
+static void BM_Zech_Construction(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  uint32_t poly = GetIrreduciblePolyBits(m);
+  size_t table_bytes = 0;
+
+  for (auto _ : WithPerfCounters(state)) {
+    gfb::WithGF2mZech(m, poly, [&](const auto &field) {
+      benchmark::DoNotOptimize(field.ZechTable());
+      table_bytes = field.TableBytes();
+    });
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.cardinality();
+  SetConstructionCounters(state, m);
+  state.counters["TableBytes"] = table_bytes;
 }
 
-static void BM_Givaro_Inversion(benchmark::State &state) {
+static void BM_Zech_CachedConstruction(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  std::vector<int> poly = GetGivaroIrreduciblePoly(m);
-  Givaro::GFq<int64_t> field(2, m, poly);
+  bool touch = state.range(1) != 0;
+  uint32_t poly = GetIrreduciblePolyBits(m);
+  const std::string directory = GetTableCacheDirectory();
+
+  auto run = [&](auto index_tag) {
+    using IndexT = decltype(index_tag);
+    // Populates the cache; later runs of this degree only map it
+    gfb::OpenCachedGF2mZech<IndexT>(directory, m, poly);
+    const std::string path =
+        (std::filesystem::path(directory) /
+         gfb::ZechTableFileName(m, poly, sizeof(IndexT)))
+            .string();
+    const size_t page_entries = 4096 / sizeof(IndexT);
+    size_t table_bytes = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      gfb::GF2mZech<IndexT> field = gfb::MapZechTables<IndexT>(path);
+      if (touch) {
+        // All three tables are contiguous in the mapping
+        const IndexT *tables = field.LogTable();
+        IndexT sum = 0;
+        for (size_t i = 0; i < 3 * size_t{field.Order()}; i += page_entries) {
+          sum ^= tables[i];
+        }
+        benchmark::DoNotOptimize(sum);
+      }
+      benchmark::DoNotOptimize(field.ZechTable());
+      table_bytes = field.TableBytes();
+    }
 
-  auto elements = GenerateRandomGivaroElements(field, 10000);
-  size_t idx = 0;
+    SetConstructionCounters(state, m);
+    state.counters["TableBytes"] = table_bytes;
+    state.SetLabel(touch ? "mapped+touched" : "mapped");
+  };
 
-  for (auto _ : state) {
-    Givaro::GFq<int64_t>::Element result;
-    auto elem = elements[idx % elements.size()];
-    // Additional safety check to ensure element is not zero
-    if (field.isZero(elem)) {
-      field.init(elem, 1); // Set to 1 if somehow zero
+  try {
+    if (m <= 16) {
+      run(uint16_t{});
+    } else {
+      run(uint32_t{});
     }
-    field.inv(result, elem);
-    benchmark::DoNotOptimize(result);
-    idx++;
+  } catch (const std::runtime_error &e) {
+    state.SkipWithError(e.what());
   }
+}
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.cardinality();
+static void BM_Clmul_Construction(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  uint64_t low = GetClmulModulusLow(m);
+
+  for (auto _ : WithPerfCounters(state)) {
+    gfb::GF2mClmul field(m, low, gfb::ClmulReduction::kBarrett);
+    benchmark::DoNotOptimize(field);
+  }
+
+  SetConstructionCounters(state, m);
 }
 
 //------------------------------------------------------------------------------
-// xgalois GF2XZECH Benchmarks
+// Exponentiation Benchmarks
 //------------------------------------------------------------------------------
+//
+// a^e for each backend over two exponent streams:
+//  - random: e uniform in [1, 2^m - 2], the general case;
+//  - fermat: e = 2^m - 2, i.e. inversion by Fermat's little theorem, the
+//    worst-case exponent (m - 1 set bits) of fixed-exponent paths.
+// Givaro and NTL use their own pow/power. xgalois has no power function, so
+// it runs the square-and-multiply a caller would write over its Mul. The
+// Zech field works in the log domain (one modular multiply, see
+// GF2mZech::Pow). GF2mClmul runs each engine in gfb/field/gf2m_pow.hpp:
+// square-and-multiply, a 4-bit sliding window and the Frobenius-table
+// fixed window, over the single-word degrees. One iteration is one power
+// of a fresh random nonzero base. Arguments are {m, exponent} and, for
+// CLMUL, {m, exponent, engine}.
+
+enum class ExponentKind { kRandom, kFermat };
+
+enum class PowEngine { kSquareMultiply, kSlidingWindow, kFrobenius };
+
+const char *ExponentKindName(ExponentKind kind) {
+  return kind == ExponentKind::kFermat ? "fermat" : "random";
+}
+
+const char *PowEngineName(PowEngine engine) {
+  switch (engine) {
+    case PowEngine::kSquareMultiply: return "square-multiply";
+    case PowEngine::kSlidingWindow: return "sliding-window";
+    default: return "frobenius";
+  }
+}
+
+const size_t EXPONENT_STREAM = 1024;
+const unsigned POW_WINDOW = 4;
+
+static void ExponentiationArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : FIELD_DEGREES) {
+    for (ExponentKind kind : {ExponentKind::kRandom, ExponentKind::kFermat}) {
+      b->Args({m, static_cast<int64_t>(kind)});
+    }
+  }
+}
+
+static void ClmulExponentiationArguments(benchmark::internal::Benchmark *b) {
+  for (uint8_t m : CLMUL_DEGREES) {
+    for (ExponentKind kind : {ExponentKind::kRandom, ExponentKind::kFermat}) {
+      for (PowEngine engine : {PowEngine::kSquareMultiply,
+                               PowEngine::kSlidingWindow,
+                               PowEngine::kFrobenius}) {
+        b->Args({m, static_cast<int64_t>(kind), static_cast<int64_t>(engine)});
+      }
+    }
+  }
+}
 
-static void BM_Xgalois_Addition(benchmark::State &state) {
+// Exponents in [1, 2^m - 2] (m <= 64), or 2^m - 2 throughout
+std::vector<uint64_t> GenerateExponents(uint8_t m, ExponentKind kind,
+                                        size_t count, uint32_t seed = 7) {
+  const uint64_t order_minus_one =
+      m == 64 ? ~uint64_t{0} : (uint64_t{1} << m) - 1;
+  std::vector<uint64_t> exponents(count, order_minus_one - 1);
+  if (kind == ExponentKind::kRandom) {
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<uint64_t> dis(1, order_minus_one - 1);
+    for (auto &e : exponents) e = dis(gen);
+  }
+  return exponents;
+}
+
+static void SetExponentiationCounters(benchmark::State &state, uint8_t m,
+                                      ExponentKind kind) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  state.counters["FieldDegree"] = m;
+  state.SetLabel(ExponentKindName(kind));
+}
+
+static void BM_Givaro_Exponentiation(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
+  auto kind = static_cast<ExponentKind>(state.range(1));
+  Givaro::GFq<int64_t> field(2, m, GetGivaroIrreduciblePoly(m));
 
-  auto elements = GenerateRandomXgaloisElements(field, 10000);
+  auto elements = GenerateRandomGivaroElements(field, EXPONENT_STREAM);
+  auto exponents = GenerateExponents(m, kind, EXPONENT_STREAM);
   size_t idx = 0;
 
-  for (auto _ : state) {
-    uint32_t result = field.Add(elements[idx % elements.size()],
-                               elements[(idx + 1) % elements.size()]);
+  for (auto _ : WithPerfCounters(state)) {
+    Givaro::GFq<int64_t>::Element result;
+    field.pow(result, elements[idx % EXPONENT_STREAM],
+              exponents[idx % EXPONENT_STREAM]);
     benchmark::DoNotOptimize(result);
     idx++;
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.Order();
+  SetExponentiationCounters(state, m, kind);
 }
 
-static void BM_Xgalois_Multiplication(benchmark::State &state) {
+static void BM_Xgalois_Exponentiation(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto kind = static_cast<ExponentKind>(state.range(1));
   xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
 
-  auto elements = GenerateRandomXgaloisElements(field, 10000);
+  auto elements = GenerateRandomXgaloisElements(field, EXPONENT_STREAM);
+  auto exponents = GenerateExponents(m, kind, EXPONENT_STREAM);
   size_t idx = 0;
 
-  for (auto _ : state) {
-    uint32_t result = field.Mul(elements[idx % elements.size()],
-                               elements[(idx + 1) % elements.size()]);
+  for (auto _ : WithPerfCounters(state)) {
+    uint32_t result = gfb::PowSquareMultiply(
+        field, elements[idx % EXPONENT_STREAM], exponents[idx % EXPONENT_STREAM],
+        uint32_t{1});
     benchmark::DoNotOptimize(result);
     idx++;
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.Order();
+  SetExponentiationCounters(state, m, kind);
 }
 
-static void BM_Xgalois_Division(benchmark::State &state) {
+static void BM_NTL_Exponentiation(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
+  auto kind = static_cast<ExponentKind>(state.range(1));
+  NTL::GF2E::init(GetNTLIrreduciblePoly(m));
 
-  auto elements = GenerateRandomXgaloisElements(field, 10000);
+  auto elements = GenerateRandomNTLElements(EXPONENT_STREAM);
+  auto exponents = GenerateExponents(m, kind, EXPONENT_STREAM);
   size_t idx = 0;
 
-  for (auto _ : state) {
-    uint32_t divisor = elements[(idx + 1) % elements.size()];
-    // Additional safety check to ensure divisor is not zero
-    if (divisor == 0) {
-      divisor = 1; // Set to 1 if somehow zero
-    }
-    uint32_t result = field.Div(elements[idx % elements.size()], divisor);
+  for (auto _ : WithPerfCounters(state)) {
+    NTL::GF2E result;
+    NTL::power(result, elements[idx % EXPONENT_STREAM],
+               static_cast<long>(exponents[idx % EXPONENT_STREAM]));
     benchmark::DoNotOptimize(result);
     idx++;
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.Order();
+  SetExponentiationCounters(state, m, kind);
 }
 
-static void BM_Xgalois_Inversion(benchmark::State &state) {
+static void BM_Zech_Exponentiation(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  xg::GF2XZECH field(m, "log", GetIrreduciblePoly(m));
+  auto kind = static_cast<ExponentKind>(state.range(1));
+  gfb::WithGF2mZech(m, GetIrreduciblePolyBits(m), [&](const auto &field) {
+    auto elements = GenerateRandomZechElements(field, EXPONENT_STREAM);
+    auto exponents = GenerateExponents(m, kind, EXPONENT_STREAM);
+    size_t idx = 0;
+
+    for (auto _ : WithPerfCounters(state)) {
+      auto result = field.Pow(elements[idx % EXPONENT_STREAM],
+                              exponents[idx % EXPONENT_STREAM]);
+      benchmark::DoNotOptimize(result);
+      idx++;
+    }
+
+    state.counters["TableBytes"] = field.TableBytes();
+  });
+
+  SetExponentiationCounters(state, m, kind);
+}
 
-  auto elements = GenerateRandomXgaloisElements(field, 10000);
+static void BM_Clmul_Exponentiation(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  auto kind = static_cast<ExponentKind>(state.range(1));
+  auto engine = static_cast<PowEngine>(state.range(2));
+  gfb::GF2mClmul field(m, GetClmulModulusLow(m));
+  gfb::GF2mFrobeniusPow<gfb::GF2mClmul> frobenius(field, POW_WINDOW);
+
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<uint64_t> dis(1, field.Order() - 1);
+  std::vector<uint64_t> elements(EXPONENT_STREAM);
+  for (auto &e : elements) e = dis(gen);
+  auto exponents = GenerateExponents(m, kind, EXPONENT_STREAM);
   size_t idx = 0;
 
-  for (auto _ : state) {
-    uint32_t elem = elements[idx % elements.size()];
-    // Additional safety check to ensure element is not zero
-    if (elem == 0) {
-      elem = 1; // Set to 1 if somehow zero
+  for (auto _ : WithPerfCounters(state)) {
+    uint64_t a = elements[idx % EXPONENT_STREAM];
+    uint64_t e = exponents[idx % EXPONENT_STREAM];
+    uint64_t result;
+    switch (engine) {
+      case PowEngine::kSquareMultiply:
+        result = gfb::PowSquareMultiply(field, a, e, field.One());
+        break;
+      case PowEngine::kSlidingWindow:
+        result = gfb::PowSlidingWindow(field, a, e, field.One(), POW_WINDOW);
+        break;
+      default:
+        result = frobenius.Pow(a, e);
+        break;
     }
-    uint32_t result = field.Inv(elem);
     benchmark::DoNotOptimize(result);
     idx++;
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = field.Order();
+  SetExponentiationCounters(state, m, kind);
+  state.counters["TableBytes"] =
+      engine == PowEngine::kFrobenius ? frobenius.TableBytes() : 0;
+  state.SetLabel(std::string(PowEngineName(engine)) + "/" +
+                 ExponentKindName(kind));
 }
 
 //------------------------------------------------------------------------------
-// NTL GF2E Benchmarks
+// Polynomial Arithmetic Benchmarks
 //------------------------------------------------------------------------------
+//
+// Dense polynomial arithmetic over GF(2^16) for each backend, through
+// gfb::PolyArith (gfb/poly/poly_arith.hpp), to find the degree at which the
+// fast algorithm overtakes the textbook one:
+//  - PolyMul: schoolbook vs. Karatsuba, two degree-d operands;
+//  - PolyDivRem: long division vs. Newton iteration, a degree-2d dividend
+//    by a degree-d divisor (a full-size quotient, the worst case for long
+//    division);
+//  - PolyGcd: Euclid over either division, two random degree-d operands;
+//  - PolyMulCutoff: Karatsuba at d = 1024 with the schoolbook cutoff swept,
+//    to tune PolyArith's default per backend.
+// Coefficients are random nonzero elements. Arguments are {m, d}, or
+// {m, d, cutoff}, with d swept in powers of two; the quadratic algorithms
+// stop at a lower degree, and NTL, whose element ops are an order of
+// magnitude slower, stops earlier still.
+
+const uint8_t POLY_FIELD_DEGREE = 16;
+const int64_t POLY_MIN_DEGREE = 16;
+const int64_t POLY_MAX_DEGREE = 65536;
+const int64_t POLY_QUADRATIC_MAX_DEGREE = 8192;
+const int64_t POLY_NTL_MAX_DEGREE = 4096;
+const int64_t POLY_NTL_QUADRATIC_MAX_DEGREE = 1024;
+const int64_t POLY_CUTOFF_DEGREE = 1024;
+
+static void SetPolyCounters(benchmark::State &state, int64_t d,
+                            size_t karatsuba_cutoff) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (d + 1));
+  state.counters["FieldDegree"] = state.range(0);
+  state.counters["PolyDegree"] = static_cast<double>(d);
+  state.counters["KaratsubaCutoff"] = static_cast<double>(karatsuba_cutoff);
+}
 
-static void BM_NTL_Addition(benchmark::State &state) {
-  uint8_t m = static_cast<uint8_t>(state.range(0));
-  NTL::GF2X poly = GetNTLIrreduciblePoly(m);
-  NTL::GF2E::init(poly);
-
-  auto elements = GenerateRandomNTLElements(10000);
-  size_t idx = 0;
-
-  for (auto _ : state) {
-    NTL::GF2E result = elements[idx % elements.size()] + elements[(idx + 1) % elements.size()];
-    benchmark::DoNotOptimize(result);
-    idx++;
+template <gfb::PolyMulAlgorithm Algorithm, FieldBackend Field>
+static void RunPolyMul(benchmark::State &state, const Field &field,
+                       const gfb::PolyArith<Field> &poly, int64_t d) {
+  auto a = GenerateRandomAdapterElements(field, static_cast<size_t>(d + 1), 42);
+  auto b = GenerateRandomAdapterElements(field, static_cast<size_t>(d + 1), 43);
+  typename gfb::PolyArith<Field>::Poly r;
+
+  for (auto _ : WithPerfCounters(state)) {
+    poly.Mul(r, a, b, Algorithm);
+    benchmark::DoNotOptimize(r.data());
+    benchmark::ClobberMemory();
   }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = 1UL << m;
+  SetPolyCounters(state, d, poly.KaratsubaCutoff());
 }
 
-static void BM_NTL_Multiplication(benchmark::State &state) {
+template <typename Backend, gfb::PolyMulAlgorithm Algorithm>
+static void BM_PolyMul(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  NTL::GF2X poly = GetNTLIrreduciblePoly(m);
-  NTL::GF2E::init(poly);
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    RunPolyMul<Algorithm>(state, field, gfb::PolyArith<Field>(field), state.range(1));
+  });
+}
 
-  auto elements = GenerateRandomNTLElements(10000);
-  size_t idx = 0;
+template <typename Backend>
+static void BM_PolyMulCutoff(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t cutoff = static_cast<size_t>(state.range(2));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    RunPolyMul<gfb::PolyMulAlgorithm::kKaratsuba>(
+        state, field, gfb::PolyArith<Field>(field, cutoff), state.range(1));
+  });
+}
 
-  for (auto _ : state) {
-    NTL::GF2E result = elements[idx % elements.size()] * elements[(idx + 1) % elements.size()];
-    benchmark::DoNotOptimize(result);
-    idx++;
-  }
+template <typename Backend, gfb::PolyDivAlgorithm Algorithm>
+static void BM_PolyDivRem(benchmark::State &state) {
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  int64_t d = state.range(1);
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    gfb::PolyArith<Field> poly(field);
+    auto a = GenerateRandomAdapterElements(field, static_cast<size_t>(2 * d + 1), 42);
+    auto b = GenerateRandomAdapterElements(field, static_cast<size_t>(d + 1), 43);
+    typename gfb::PolyArith<Field>::Poly q, r;
+
+    for (auto _ : WithPerfCounters(state)) {
+      poly.DivRem(q, r, a, b, Algorithm);
+      benchmark::DoNotOptimize(q.data());
+      benchmark::DoNotOptimize(r.data());
+      benchmark::ClobberMemory();
+    }
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = 1UL << m;
+    SetPolyCounters(state, d, poly.KaratsubaCutoff());
+  });
 }
 
-static void BM_NTL_Division(benchmark::State &state) {
+template <typename Backend, gfb::PolyDivAlgorithm Algorithm>
+static void BM_PolyGcd(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  NTL::GF2X poly = GetNTLIrreduciblePoly(m);
-  NTL::GF2E::init(poly);
+  int64_t d = state.range(1);
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    gfb::PolyArith<Field> poly(field);
+    auto a = GenerateRandomAdapterElements(field, static_cast<size_t>(d + 1), 42);
+    auto b = GenerateRandomAdapterElements(field, static_cast<size_t>(d + 1), 43);
+    typename gfb::PolyArith<Field>::Poly g;
+
+    for (auto _ : WithPerfCounters(state)) {
+      poly.Gcd(g, a, b, Algorithm);
+      benchmark::DoNotOptimize(g.data());
+      benchmark::ClobberMemory();
+    }
 
-  auto elements = GenerateRandomNTLElements(10000);
-  size_t idx = 0;
+    SetPolyCounters(state, d, poly.KaratsubaCutoff());
+    state.counters["GcdDegree"] = static_cast<double>(gfb::PolyArith<Field>::Degree(g));
+  });
+}
 
-  for (auto _ : state) {
-    NTL::GF2E divisor = elements[(idx + 1) % elements.size()];
-    // Additional safety check to ensure divisor is not zero
-    if (NTL::IsZero(divisor)) {
-      divisor = NTL::to_GF2E(1); // Set to 1 if somehow zero
-    }
-    NTL::GF2E result = elements[idx % elements.size()] / divisor;
-    benchmark::DoNotOptimize(result);
-    idx++;
+static void PolyArguments(benchmark::internal::Benchmark *b, int64_t max_degree) {
+  for (int64_t d = POLY_MIN_DEGREE; d <= max_degree; d *= 2) {
+    b->Args({POLY_FIELD_DEGREE, d});
   }
+}
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = 1UL << m;
+static void PolyCutoffArguments(benchmark::internal::Benchmark *b) {
+  for (int64_t cutoff = 2; cutoff <= 256; cutoff *= 2) {
+    b->Args({POLY_FIELD_DEGREE, POLY_CUTOFF_DEGREE, cutoff});
+  }
+}
+
+// Registers BM_<backend>_Poly{Mul,DivRem,Gcd}/<algorithm> and
+// BM_<backend>_PolyMulCutoff
+template <typename Backend>
+static void RegisterPolyBenchmarks(int64_t quadratic_max_degree, int64_t max_degree) {
+  using gfb::PolyDivAlgorithm;
+  using gfb::PolyMulAlgorithm;
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_Poly";
+  auto add = [](const std::string &name, auto fn, int64_t max) {
+    PolyArguments(benchmark::RegisterBenchmark(name.c_str(), fn)->Unit(benchmark::kMicrosecond),
+                  max);
+  };
+  add(prefix + "Mul/Schoolbook", BM_PolyMul<Backend, PolyMulAlgorithm::kSchoolbook>,
+      quadratic_max_degree);
+  add(prefix + "Mul/Karatsuba", BM_PolyMul<Backend, PolyMulAlgorithm::kKaratsuba>,
+      max_degree);
+  add(prefix + "DivRem/Schoolbook", BM_PolyDivRem<Backend, PolyDivAlgorithm::kSchoolbook>,
+      quadratic_max_degree);
+  add(prefix + "DivRem/Newton", BM_PolyDivRem<Backend, PolyDivAlgorithm::kNewton>,
+      max_degree);
+  add(prefix + "Gcd/Schoolbook", BM_PolyGcd<Backend, PolyDivAlgorithm::kSchoolbook>,
+      quadratic_max_degree);
+  add(prefix + "Gcd/Newton", BM_PolyGcd<Backend, PolyDivAlgorithm::kNewton>,
+      quadratic_max_degree);
+  benchmark::RegisterBenchmark((prefix + "MulCutoff").c_str(), BM_PolyMulCutoff<Backend>)
+      ->Apply(PolyCutoffArguments)->Unit(benchmark::kMicrosecond);
+}
+
+//------------------------------------------------------------------------------
+// Matrix Benchmarks
+//------------------------------------------------------------------------------
+//
+// Dense n x n matrix kernels over GF(2^8) and GF(2^16) for each backend,
+// through gfb::MatrixArith (gfb/linalg/matrix_arith.hpp), i.e. the decode
+// side of an erasure code at realistic and stress sizes:
+//  - MatVec: y = A x;
+//  - MatMul: C = A B, as dot products (Naive) or over packed tiles of B
+//    (Blocked);
+//  - MatInvert: Gauss-Jordan on [A | I] one pivot at a time (GaussJordan)
+//    or one panel of pivots at a time with a tiled trailing update
+//    (Blocked).
+// Entries are random nonzero elements; inverted matrices are redrawn until
+// nonsingular. items/s counts field multiply-adds (n^2 or n^3). Arguments
+// are {m, n} with n swept in powers of two from 8; MatVec reaches 4096
+// (1024 for NTL) and the O(n^3) kernels stop at 512 (128 for NTL), where
+// one call already takes about a second.
+
+const std::vector<uint8_t> MATRIX_DEGREES = {8, 16};
+const int64_t MATRIX_MIN_SIZE = 8;
+const int64_t MATRIX_MAX_SIZE = 4096;
+const int64_t MATRIX_NTL_MAX_SIZE = 1024;
+const int64_t MATRIX_CUBIC_MAX_SIZE = 512;
+const int64_t MATRIX_NTL_CUBIC_MAX_SIZE = 128;
+
+enum class MatrixKernel { kMatVec, kMatMul, kMatMulBlocked, kInvert, kInvertBlocked };
+
+// A random nonsingular n x n matrix
+template <FieldBackend Field>
+static std::vector<typename Field::Element>
+GenerateInvertibleMatrix(const Field &field, const gfb::MatrixArith<Field> &matrix,
+                         size_t n) {
+  for (uint32_t seed = 42;; ++seed) {
+    auto a = GenerateRandomAdapterElements(field, n * n, seed);
+    if (matrix.Rank(a.data(), n, n) == n) return a;
+  }
 }
 
-static void BM_NTL_Inversion(benchmark::State &state) {
+template <typename Backend, MatrixKernel Kernel>
+static void BM_Matrix(benchmark::State &state) {
   uint8_t m = static_cast<uint8_t>(state.range(0));
-  NTL::GF2X poly = GetNTLIrreduciblePoly(m);
-  NTL::GF2E::init(poly);
+  size_t n = static_cast<size_t>(state.range(1));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    gfb::MatrixArith<Field> matrix(field);
+    constexpr bool kInversion =
+        Kernel == MatrixKernel::kInvert || Kernel == MatrixKernel::kInvertBlocked;
+    auto a = kInversion ? GenerateInvertibleMatrix(field, matrix, n)
+                        : GenerateRandomAdapterElements(field, n * n, 42);
+    auto b = GenerateRandomAdapterElements(field, Kernel == MatrixKernel::kMatVec ? n : n * n, 43);
+    std::vector<typename Field::Element> c(Kernel == MatrixKernel::kMatVec ? n : n * n);
+
+    for (auto _ : WithPerfCounters(state)) {
+      if constexpr (Kernel == MatrixKernel::kMatVec) matrix.MulVec(c.data(), a.data(), b.data(), n, n);
+      if constexpr (Kernel == MatrixKernel::kMatMul) matrix.Mul(c.data(), a.data(), b.data(), n, n, n);
+      if constexpr (Kernel == MatrixKernel::kMatMulBlocked) matrix.MulBlocked(c.data(), a.data(), b.data(), n, n, n);
+      if constexpr (Kernel == MatrixKernel::kInvert) matrix.Invert(c.data(), a.data(), n);
+      if constexpr (Kernel == MatrixKernel::kInvertBlocked) matrix.InvertBlocked(c.data(), a.data(), n);
+      benchmark::DoNotOptimize(c.data());
+      benchmark::ClobberMemory();
+    }
 
-  auto elements = GenerateRandomNTLElements(10000);
-  size_t idx = 0;
+    const int64_t ops = Kernel == MatrixKernel::kMatVec
+                            ? static_cast<int64_t>(n * n)
+                            : static_cast<int64_t>(n * n * n);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ops);
+    state.counters["FieldDegree"] = m;
+    state.counters["MatrixSize"] = static_cast<double>(n);
+    state.counters["MatrixBytes"] = static_cast<double>(n * n * Field::kElementBytes);
+    state.counters["Block"] = static_cast<double>(matrix.Block());
+  });
+}
 
-  for (auto _ : state) {
-    NTL::GF2E elem = elements[idx % elements.size()];
-    // Additional safety check to ensure element is not zero
-    if (NTL::IsZero(elem)) {
-      elem = NTL::to_GF2E(1); // Set to 1 if somehow zero
+static void MatrixArguments(benchmark::internal::Benchmark *b, int64_t max_size) {
+  for (uint8_t m : MATRIX_DEGREES) {
+    for (int64_t n = MATRIX_MIN_SIZE; n <= max_size; n *= 2) {
+      b->Args({m, n});
     }
-    NTL::GF2E result = NTL::inv(elem);
-    benchmark::DoNotOptimize(result);
-    idx++;
   }
+}
 
-  MemoryUsage mem_end = GetMemoryUsage();
-  state.counters["MemoryPeak_KB"] = mem_end.peak_rss_kb;
-  state.counters["FieldOrder"] = 1UL << m;
+// Registers BM_<backend>_MatVec, _MatMul/{Naive,Blocked} and
+// _MatInvert/{GaussJordan,Blocked}
+template <typename Backend>
+static void RegisterMatrixBenchmarks(int64_t max_size, int64_t cubic_max_size) {
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_Mat";
+  auto add = [](const std::string &name, auto fn, int64_t max_size) {
+    MatrixArguments(benchmark::RegisterBenchmark(name.c_str(), fn)->Unit(benchmark::kMicrosecond),
+                    max_size);
+  };
+  add(prefix + "Vec", BM_Matrix<Backend, MatrixKernel::kMatVec>, max_size);
+  add(prefix + "Mul/Naive", BM_Matrix<Backend, MatrixKernel::kMatMul>, cubic_max_size);
+  add(prefix + "Mul/Blocked", BM_Matrix<Backend, MatrixKernel::kMatMulBlocked>, cubic_max_size);
+  add(prefix + "Invert/GaussJordan", BM_Matrix<Backend, MatrixKernel::kInvert>, cubic_max_size);
+  add(prefix + "Invert/Blocked", BM_Matrix<Backend, MatrixKernel::kInvertBlocked>, cubic_max_size);
 }
 
 //------------------------------------------------------------------------------
-// Benchmark Registration
+// Bitsliced Arithmetic Benchmarks
 //------------------------------------------------------------------------------
+//
+// gfb::GF2mBitslice (gfb/field/gf2m_bitslice.hpp) adds and multiplies 64 or
+// 256 independent elements at a time as m bit-planes, with a fixed AND/XOR
+// network and no tables. Each width is measured three ways over n elements:
+//  - Bitslice<L>_<Op>: polynomial-basis buffers in and out, i.e. including
+//    both transposes, which is what a caller with ordinary arrays pays;
+//  - Bitslice<L>_<Op>Planes: operands already resident as planes, i.e. the
+//    network alone, for callers that keep data bitsliced across many ops;
+//  - Bitslice<L>_Transpose: one buffer into planes and back.
+// Givaro and xgalois run BM_FieldBulk over the same degrees and sizes, as
+// BM_<backend>_BitsliceBaseline<Op>. All of them draw the same operand values (seeds
+// 42 and 43, uniform over the nonzero elements), so items/s compare
+// directly. Arguments are {m, n}.
+
+const uint8_t BITSLICE_MIN_DEGREE = 4;
+const uint8_t BITSLICE_MAX_DEGREE = 16;
+const std::vector<int64_t> BITSLICE_ELEMENTS = {1 << 12, 1 << 20};
+
+enum class BitsliceMode { kBuffer, kPlanes, kTranspose };
+
+static void BitsliceArguments(benchmark::internal::Benchmark *b) {
+  for (int64_t m = BITSLICE_MIN_DEGREE; m <= BITSLICE_MAX_DEGREE; ++m) {
+    for (int64_t n : BITSLICE_ELEMENTS) {
+      b->Args({m, n});
+    }
+  }
+}
 
-// Register benchmarks for all field sizes {4,8,12,16,20}
-BENCHMARK(BM_Givaro_Addition)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
-
-BENCHMARK(BM_Givaro_Multiplication)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+// The same corpus values as GenerateRandomAdapterElements
+std::vector<uint16_t> GenerateRandomBitsliceElements(uint8_t m, size_t count,
+                                                     uint32_t seed = 42) {
+  gfb::OperandCorpus corpus = GetOperandCorpus(m, count, seed);
+  return std::vector<uint16_t>(corpus.data(), corpus.data() + count);
+}
 
-BENCHMARK(BM_Givaro_Division)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+template <typename Word, FieldOp Op, BitsliceMode Mode>
+static void BM_Bitslice(benchmark::State &state) {
+  static_assert(Op == FieldOp::kAddition || Op == FieldOp::kMultiplication);
+  using Bitslice = gfb::GF2mBitslice<Word>;
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t n = static_cast<size_t>(state.range(1));
+  Bitslice field(m, GetIrreduciblePolyBits(m));
+
+  auto a = GenerateRandomBitsliceElements(m, n, 42);
+  auto b = GenerateRandomBitsliceElements(m, n, 43);
+  std::vector<uint16_t> c(n);
+
+  if constexpr (Mode == BitsliceMode::kBuffer) {
+    for (auto _ : WithPerfCounters(state)) {
+      if constexpr (Op == FieldOp::kAddition) {
+        field.AddBuffer(c.data(), a.data(), b.data(), n);
+      } else {
+        field.MulBuffer(c.data(), a.data(), b.data(), n);
+      }
+      benchmark::ClobberMemory();
+    }
+  } else if constexpr (Mode == BitsliceMode::kPlanes) {
+    // n is a multiple of every lane count
+    const size_t batches = n / Bitslice::kLanes;
+    std::vector<typename Bitslice::Planes> pa(batches), pb(batches), pc(batches);
+    for (size_t i = 0; i < batches; ++i) {
+      field.Load(pa[i], &a[i * Bitslice::kLanes]);
+      field.Load(pb[i], &b[i * Bitslice::kLanes]);
+    }
+    for (auto _ : WithPerfCounters(state)) {
+      for (size_t i = 0; i < batches; ++i) {
+        if constexpr (Op == FieldOp::kAddition) {
+          field.Add(pc[i], pa[i], pb[i]);
+        } else {
+          field.Mul(pc[i], pa[i], pb[i]);
+        }
+      }
+      benchmark::ClobberMemory();
+    }
+  } else {
+    typename Bitslice::Planes planes;
+    for (auto _ : WithPerfCounters(state)) {
+      for (size_t i = 0; i < n; i += Bitslice::kLanes) {
+        field.Load(planes, &a[i]);
+        field.Store(&c[i], planes);
+      }
+      benchmark::ClobberMemory();
+    }
+  }
 
-BENCHMARK(BM_Givaro_Inversion)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+  SetBulkCounters(state, n, sizeof(uint16_t),
+                  Mode == BitsliceMode::kTranspose ? 1 : 2);
+  state.counters["Lanes"] = static_cast<double>(Bitslice::kLanes);
+  state.counters["FieldOrder"] = static_cast<double>(uint64_t{1} << m);
+}
 
-BENCHMARK(BM_Xgalois_Addition)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+// Registers BM_Bitslice<lanes>_{Addition,Multiplication}[Planes] and
+// BM_Bitslice<lanes>_Transpose
+template <typename Word> static void RegisterBitsliceBenchmarks() {
+  const std::string prefix =
+      "BM_Bitslice" + std::to_string(gfb::GF2mBitslice<Word>::kLanes) + "_";
+  auto add = [](const std::string &name, auto fn) {
+    benchmark::RegisterBenchmark(name.c_str(), fn)
+        ->Apply(BitsliceArguments)->Unit(benchmark::kMicrosecond);
+  };
+  add(prefix + "Addition", BM_Bitslice<Word, FieldOp::kAddition, BitsliceMode::kBuffer>);
+  add(prefix + "Multiplication", BM_Bitslice<Word, FieldOp::kMultiplication, BitsliceMode::kBuffer>);
+  add(prefix + "AdditionPlanes", BM_Bitslice<Word, FieldOp::kAddition, BitsliceMode::kPlanes>);
+  add(prefix + "MultiplicationPlanes", BM_Bitslice<Word, FieldOp::kMultiplication, BitsliceMode::kPlanes>);
+  add(prefix + "Transpose", BM_Bitslice<Word, FieldOp::kAddition, BitsliceMode::kTranspose>);
+}
 
-BENCHMARK(BM_Xgalois_Multiplication)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+// The table baselines: BM_<backend>_BitsliceBaseline{Addition,Multiplication}
+template <typename Backend> static void RegisterBitsliceBaselines() {
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_BitsliceBaseline";
+  benchmark::RegisterBenchmark((prefix + "Addition").c_str(),
+                               BM_FieldBulk<Backend, FieldOp::kAddition>)
+      ->Apply(BitsliceArguments)->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark((prefix + "Multiplication").c_str(),
+                               BM_FieldBulk<Backend, FieldOp::kMultiplication>)
+      ->Apply(BitsliceArguments)->Unit(benchmark::kMicrosecond);
+}
 
-BENCHMARK(BM_Xgalois_Division)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+//------------------------------------------------------------------------------
+// Batch Inversion Benchmarks
+//------------------------------------------------------------------------------
+//
+// gfb::BatchArith (gfb/field/batch_arith.hpp) inverts or divides n elements
+// with Montgomery's trick: one inversion plus 3(n - 1) multiplications, one
+// more per element for division. Each backend runs it against the
+// element-wise loop (BM_FieldBulk) on the same operands, as
+//   BM_<backend>_Batch{Inversion,Division}/{Montgomery,Elementwise}
+// with arguments {m, n} and n swept from 4 to 64K. The crossover in n and
+// the asymptotic ratio both follow from how an inversion compares with a
+// multiplication on the backend.
+
+const std::vector<int64_t> BATCH_DEGREES = {8, 16};
+const int64_t BATCH_MIN_ELEMENTS = 4;
+const int64_t BATCH_MAX_ELEMENTS = 1 << 16;
+
+static void BatchArguments(benchmark::internal::Benchmark *b) {
+  for (int64_t m : BATCH_DEGREES) {
+    for (int64_t n = BATCH_MIN_ELEMENTS; n <= BATCH_MAX_ELEMENTS; n *= 4) {
+      b->Args({m, n});
+    }
+  }
+}
 
-BENCHMARK(BM_Xgalois_Inversion)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+template <typename Backend, FieldOp Op>
+static void BM_FieldBatch(benchmark::State &state) {
+  static_assert(Op == FieldOp::kDivision || Op == FieldOp::kInversion);
+  uint8_t m = static_cast<uint8_t>(state.range(0));
+  size_t n = static_cast<size_t>(state.range(1));
+  WithFieldBackend<Backend>(m, [&]<FieldBackend Field>(const Field &field) {
+    gfb::BatchArith<Field> batch(field);
+    auto a = GenerateRandomAdapterElements(field, n, 42);
+    auto b = GenerateRandomAdapterElements(field, n, 43);
+    std::vector<typename Field::Element> c(n);
+
+    for (auto _ : WithPerfCounters(state)) {
+      if constexpr (Op == FieldOp::kInversion) {
+        batch.Inv(c.data(), a.data(), n);
+      } else {
+        batch.Div(c.data(), a.data(), b.data(), n);
+      }
+      benchmark::ClobberMemory();
+    }
 
-BENCHMARK(BM_NTL_Addition)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+    SetBulkCounters(state, n, Field::kElementBytes,
+                    Op == FieldOp::kInversion ? 1 : 2);
+    state.counters["FieldOrder"] = static_cast<double>(field.Order());
+  });
+}
 
-BENCHMARK(BM_NTL_Multiplication)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+// Registers BM_<backend>_Batch{Inversion,Division}/{Montgomery,Elementwise}
+template <typename Backend> static void RegisterBatchBenchmarks() {
+  const std::string prefix = std::string("BM_") + Backend::Name() + "_Batch";
+  auto add = [](const std::string &name, auto fn) {
+    benchmark::RegisterBenchmark(name.c_str(), fn)
+        ->Apply(BatchArguments)->Unit(benchmark::kMicrosecond);
+  };
+  add(prefix + "Inversion/Montgomery", BM_FieldBatch<Backend, FieldOp::kInversion>);
+  add(prefix + "Inversion/Elementwise", BM_FieldBulk<Backend, FieldOp::kInversion>);
+  add(prefix + "Division/Montgomery", BM_FieldBatch<Backend, FieldOp::kDivision>);
+  add(prefix + "Division/Elementwise", BM_FieldBulk<Backend, FieldOp::kDivision>);
+}
 
-BENCHMARK(BM_NTL_Division)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+//------------------------------------------------------------------------------
+// Benchmark Registration
+//------------------------------------------------------------------------------
 
-BENCHMARK(BM_NTL_Inversion)
-    ->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20)
-    ->Unit(benchmark::kNanosecond);
+// Per-op benchmarks for every degree each backend reaches
+static const int PER_DEGREE_REGISTRATION = [] {
+  RegisterOpBenchmarks<GivaroFieldAdapter>(TABLE_MAX_DEGREE);
+  RegisterOpBenchmarks<XgaloisFieldAdapter>(TABLE_MAX_DEGREE);
+  RegisterOpBenchmarks<NTLFieldAdapter>(gfb::kMaxModulusDegree);
+  RegisterOpBenchmarks<ZechBackend>(ZECH_MAX_DEGREE);
+  return 0;
+}();
+
+// Bulk throughput benchmarks: {m, n} over FIELD_DEGREES x buffer sizes
+static const int BULK_REGISTRATION = [] {
+  RegisterBulkBenchmarks<GivaroFieldAdapter>(BulkArguments);
+  RegisterBulkBenchmarks<XgaloisFieldAdapter>(BulkArguments);
+  RegisterBulkBenchmarks<NTLFieldAdapter>(BulkNTLArguments);
+  RegisterBulkBenchmarks<ZechBackend>(BulkArguments);
+  return 0;
+}();
+
+// Region multiply benchmarks: {kernel, bytes} for gfb, {m, bytes} for loops
+BENCHMARK(BM_Region_GF2_8_Multiply)->Apply(RegionKernelArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Region_GF2_8_MultiplyAdd)->Apply(RegionKernelArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Region_GF2_16_Multiply)->Apply(RegionKernelArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Region_GF2_16_MultiplyAdd)->Apply(RegionKernelArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Givaro_RegionMultiply)->Apply(RegionLoopArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Givaro_RegionMultiplyAdd)->Apply(RegionLoopArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Xgalois_RegionMultiply)->Apply(RegionLoopArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Xgalois_RegionMultiplyAdd)->Apply(RegionLoopArguments)->Unit(benchmark::kMicrosecond);
+
+// Carry-less multiply benchmarks: {m, reduction} single-word, {m} multi-word
+BENCHMARK(BM_Clmul_Multiplication)->Apply(ClmulArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Clmul_Division)->Apply(ClmulArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Clmul_Inversion)->Apply(ClmulArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ClmulWide_Multiplication)->Apply(ClmulWideArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ClmulWide_Division)->Apply(ClmulWideArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ClmulWide_Inversion)->Apply(ClmulWideArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_NTL_LargeMultiplication)->Apply(ClmulLargeArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_NTL_LargeDivision)->Apply(ClmulLargeArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_NTL_LargeInversion)->Apply(ClmulLargeArguments)->Unit(benchmark::kNanosecond);
+
+// Reed-Solomon benchmarks: {w, k, m, shard bytes, matrix}
+BENCHMARK(BM_Givaro_RSEncode)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Givaro_RSReconstruct)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Xgalois_RSEncode)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Xgalois_RSReconstruct)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NTL_RSEncode)->Apply(RSNTLArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NTL_RSReconstruct)->Apply(RSNTLArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Zech_RSEncode)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Zech_RSReconstruct)->Apply(RSArguments)->Unit(benchmark::kMicrosecond);
+
+// Multi-threaded scaling benchmarks
+static const int THREAD_REGISTRATION = [] {
+  RegisterThreadedBenchmarks<GivaroFieldAdapter>();
+  RegisterThreadedBenchmarks<XgaloisFieldAdapter>();
+  RegisterThreadedBenchmarks<NTLFieldAdapter>();
+  RegisterThreadedBenchmarks<ZechBackend>();
+  return 0;
+}();
+
+// Latency (dependent chain) and throughput (independent chains)
+static const int LATENCY_REGISTRATION = [] {
+  RegisterLatencyBenchmarks<GivaroFieldAdapter>();
+  RegisterLatencyBenchmarks<XgaloisFieldAdapter>();
+  RegisterLatencyBenchmarks<NTLFieldAdapter>();
+  RegisterLatencyBenchmarks<ZechBackend>();
+  RegisterLatencyBenchmarks<ClmulFieldAdapter>();
+  return 0;
+}();
+
+// Working-set and cache-pressure sweep (m = 8..24)
+BENCHMARK_CAPTURE(BM_Givaro_CacheSweep, Addition, FieldOpTag<FieldOp::kAddition>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Givaro_CacheSweep, Multiplication, FieldOpTag<FieldOp::kMultiplication>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Xgalois_CacheSweep, Addition, FieldOpTag<FieldOp::kAddition>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Xgalois_CacheSweep, Multiplication, FieldOpTag<FieldOp::kMultiplication>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zech_CacheSweep, Addition, FieldOpTag<FieldOp::kAddition>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Zech_CacheSweep, Multiplication, FieldOpTag<FieldOp::kMultiplication>{})
+    ->Apply(CacheArguments)->Unit(benchmark::kMicrosecond);
+
+// Table layouts: entry width, half Zech table, interleaved log/antilog
+static const int TABLE_LAYOUT_REGISTRATION = [] {
+  RegisterTableLayoutBenchmarks<ZechFieldAdapter<uint32_t>>();
+  RegisterTableLayoutBenchmarks<ZechFieldAdapter<uint16_t>>();
+  RegisterTableLayoutBenchmarks<ZechFieldAdapter<uint32_t, gfb::ZechLayout::kHalf>>();
+  RegisterTableLayoutBenchmarks<ZechFieldAdapter<uint16_t, gfb::ZechLayout::kHalf>>();
+  RegisterTableLayoutBenchmarks<LogFieldAdapter<uint32_t, gfb::LogLayout::kSeparate>>();
+  RegisterTableLayoutBenchmarks<LogFieldAdapter<uint16_t, gfb::LogLayout::kSeparate>>();
+  RegisterTableLayoutBenchmarks<LogFieldAdapter<uint32_t, gfb::LogLayout::kInterleaved>>();
+  RegisterTableLayoutBenchmarks<LogFieldAdapter<uint16_t, gfb::LogLayout::kInterleaved>>();
+  return 0;
+}();
+
+// Tower fields over GF(2^8): per-op, bulk (CLMUL as the m = 32 baseline)
+// and cache sweep for m = 16, 32
+static const int TOWER_REGISTRATION = [] {
+  RegisterTowerOpBenchmarks();
+  RegisterBulkBenchmarks<TowerBackend>(TowerBulkArguments);
+  RegisterBulkBenchmarks<ClmulFieldAdapter>(TowerBulkArguments);
+  return 0;
+}();
+BENCHMARK_CAPTURE(BM_Tower_CacheSweep, Addition, FieldOpTag<FieldOp::kAddition>{})
+    ->Apply(TowerCacheArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Tower_CacheSweep, Multiplication, FieldOpTag<FieldOp::kMultiplication>{})
+    ->Apply(TowerCacheArguments)->Unit(benchmark::kMicrosecond);
+
+// Normal basis: square and square root per backend, and the normal-basis
+// per-op benchmarks, over NORMAL_DEGREES
+static const int NORMAL_REGISTRATION = [] {
+  RegisterSquareBenchmarks<GivaroFieldAdapter>(TABLE_MAX_DEGREE);
+  RegisterSquareBenchmarks<XgaloisFieldAdapter>(TABLE_MAX_DEGREE);
+  RegisterSquareBenchmarks<NTLFieldAdapter>(gfb::kMaxModulusDegree);
+  RegisterSquareBenchmarks<ZechBackend>(ZECH_MAX_DEGREE);
+  RegisterSquareBenchmarks<ClmulFieldAdapter>(gfb::kMaxModulusDegree);
+  RegisterSquareBenchmarks<NormalFieldAdapter>(gfb::kMaxModulusDegree);
+  RegisterNormalOpBenchmarks();
+  return 0;
+}();
+
+// Trace, half-trace and quadratic solving: each backend's arithmetic vs.
+// precomputed linear maps, over TRACE_DEGREES
+static const int TRACE_REGISTRATION = [] {
+  RegisterTraceBenchmarks<GivaroFieldAdapter>(DegreesUpTo(TRACE_DEGREES, TABLE_MAX_DEGREE));
+  RegisterTraceBenchmarks<XgaloisFieldAdapter>(DegreesUpTo(TRACE_DEGREES, TABLE_MAX_DEGREE));
+  RegisterTraceBenchmarks<NTLFieldAdapter>(TRACE_DEGREES);
+  RegisterTraceBenchmarks<ZechBackend>(DegreesUpTo(TRACE_DEGREES, ZECH_MAX_DEGREE));
+  RegisterTraceBenchmarks<ClmulFieldAdapter>(TRACE_DEGREES);
+  RegisterTraceBenchmarks<NormalFieldAdapter>(TRACE_NORMAL_DEGREES);
+  RegisterTraceMapBenchmarks();
+  return 0;
+}();
+
+// Field construction: table generation vs. mapping the on-disk cache
+BENCHMARK(BM_Givaro_Construction)->Apply(ConstructionArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Xgalois_Construction)->Apply(ConstructionArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NTL_Construction)->Apply(ConstructionArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Zech_Construction)->Apply(ConstructionArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Zech_CachedConstruction)->Apply(CachedConstructionArguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Clmul_Construction)->Apply(ConstructionArguments)->Unit(benchmark::kMicrosecond);
+
+// Exponentiation: random and Fermat-inversion exponents
+BENCHMARK(BM_Givaro_Exponentiation)->Apply(ExponentiationArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Xgalois_Exponentiation)->Apply(ExponentiationArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_NTL_Exponentiation)->Apply(ExponentiationArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Zech_Exponentiation)->Apply(ExponentiationArguments)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Clmul_Exponentiation)->Apply(ClmulExponentiationArguments)->Unit(benchmark::kNanosecond);
+
+// Polynomial arithmetic: {m, d} textbook vs. fast, {m, d, cutoff} tuning
+static const int POLY_REGISTRATION = [] {
+  RegisterPolyBenchmarks<GivaroFieldAdapter>(POLY_QUADRATIC_MAX_DEGREE, POLY_MAX_DEGREE);
+  RegisterPolyBenchmarks<XgaloisFieldAdapter>(POLY_QUADRATIC_MAX_DEGREE, POLY_MAX_DEGREE);
+  RegisterPolyBenchmarks<NTLFieldAdapter>(POLY_NTL_QUADRATIC_MAX_DEGREE, POLY_NTL_MAX_DEGREE);
+  RegisterPolyBenchmarks<ZechBackend>(POLY_QUADRATIC_MAX_DEGREE, POLY_MAX_DEGREE);
+  RegisterPolyBenchmarks<ClmulFieldAdapter>(POLY_QUADRATIC_MAX_DEGREE, POLY_MAX_DEGREE);
+  return 0;
+}();
+
+// Matrix kernels: {m, n} over GF(2^8) and GF(2^16)
+static const int MATRIX_REGISTRATION = [] {
+  RegisterMatrixBenchmarks<GivaroFieldAdapter>(MATRIX_MAX_SIZE, MATRIX_CUBIC_MAX_SIZE);
+  RegisterMatrixBenchmarks<XgaloisFieldAdapter>(MATRIX_MAX_SIZE, MATRIX_CUBIC_MAX_SIZE);
+  RegisterMatrixBenchmarks<NTLFieldAdapter>(MATRIX_NTL_MAX_SIZE, MATRIX_NTL_CUBIC_MAX_SIZE);
+  RegisterMatrixBenchmarks<ZechBackend>(MATRIX_MAX_SIZE, MATRIX_CUBIC_MAX_SIZE);
+  RegisterMatrixBenchmarks<ClmulFieldAdapter>(MATRIX_MAX_SIZE, MATRIX_CUBIC_MAX_SIZE);
+  return 0;
+}();
+
+// Bitsliced batches and their table baselines: {m, n} for m = 4..16
+static const int BITSLICE_REGISTRATION = [] {
+  RegisterBitsliceBenchmarks<gfb::BitsliceWord64>();
+  RegisterBitsliceBenchmarks<gfb::BitsliceWord256>();
+  RegisterBitsliceBaselines<GivaroFieldAdapter>();
+  RegisterBitsliceBaselines<XgaloisFieldAdapter>();
+  return 0;
+}();
+
+// Batch inversion and division: Montgomery's trick vs. element-wise, {m, n}
+static const int BATCH_REGISTRATION = [] {
+  RegisterBatchBenchmarks<GivaroFieldAdapter>();
+  RegisterBatchBenchmarks<XgaloisFieldAdapter>();
+  RegisterBatchBenchmarks<NTLFieldAdapter>();
+  RegisterBatchBenchmarks<ZechBackend>();
+  RegisterBatchBenchmarks<ClmulFieldAdapter>();
+  return 0;
+}();
 
 BENCHMARK_MAIN();
@@ -0,0 +1,742 @@
+/**
+ * @file compare_results.cpp
+ * @brief Statistical comparison of Google Benchmark JSON results as Markdown
+ *
+ * Reads a baseline and one or more candidate result files written with
+ * --benchmark_out (see run_benchmark.sh), matches benchmarks by run name,
+ * and writes a Markdown report with the speedup of each candidate over the
+ * baseline, a confidence interval for it, and a regression verdict.
+ *
+ * Statistics are computed on log-times, so the speedup is a ratio of
+ * geometric means and its interval comes from a Welch t-test on the
+ * difference of log means. A change is significant when p < alpha, and is
+ * flagged as a regression or improvement only when it is also larger than
+ * the noise threshold. Runs need --benchmark_repetitions >= 2 for an
+ * interval; with one repetition the report shows the raw ratio only. Files
+ * written with --benchmark_report_aggregates_only are read from their mean
+ * and stddev aggregates.
+ *
+ * Files from before the per-degree benchmarks were split into size tiers
+ * (results/benchmark_20250624_*.json) name BM_Givaro_Addition/8 what is
+ * now BM_Givaro_Addition/Small/8; those names are read in the current form.
+ * Their m = 16 runs used x^16 + x^12 + x^3 + x + 1 rather than today's
+ * x^16 + x^5 + x^3 + x^2 + 1, which the report notes.
+ *
+ * Build:  clang++ -std=c++23 -O2 compare_results.cpp -o compare_results
+ * Usage:  compare_results [options] BASELINE.json CANDIDATE.json...
+ * Exits 1 when any candidate has a significant regression, 2 on error.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// JSON Reader
+//------------------------------------------------------------------------------
+//
+// Just enough JSON for benchmark output: the full grammar, numbers as
+// double, and \uXXXX escapes decoded only in the ASCII range (benchmark
+// names are ASCII).
+
+struct JsonValue {
+  enum class Type { kNull, kBool, kNumber, kString, kArray, kObject };
+
+  Type type = Type::kNull;
+  bool boolean = false;
+  double number = 0;
+  std::string string;
+  std::vector<JsonValue> items;  // Array elements, or object member values
+  std::vector<std::string> keys; // Object member names, parallel to items
+
+  const JsonValue *Find(const std::string &key) const {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (keys[i] == key) return &items[i];
+    }
+    return nullptr;
+  }
+
+  std::string StringOr(const std::string &key, const std::string &fallback) const {
+    const JsonValue *v = Find(key);
+    return v && v->type == Type::kString ? v->string : fallback;
+  }
+
+  double NumberOr(const std::string &key, double fallback) const {
+    const JsonValue *v = Find(key);
+    return v && v->type == Type::kNumber ? v->number : fallback;
+  }
+};
+
+class JsonParser {
+public:
+  explicit JsonParser(const std::string &text) : text_(text) {}
+
+  JsonValue Parse() {
+    JsonValue value = ParseValue();
+    SkipSpace();
+    if (pos_ != text_.size()) Fail("trailing characters");
+    return value;
+  }
+
+private:
+  [[noreturn]] void Fail(const std::string &what) const {
+    throw std::runtime_error("JSON: " + what + " at offset " + std::to_string(pos_));
+  }
+
+  void SkipSpace() {
+    while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+      pos_++;
+    }
+  }
+
+  void Expect(char c) {
+    SkipSpace();
+    if (pos_ >= text_.size() || text_[pos_] != c) Fail(std::string("expected '") + c + "'");
+    pos_++;
+  }
+
+  bool Consume(const char *word) {
+    size_t n = std::char_traits<char>::length(word);
+    if (text_.compare(pos_, n, word) != 0) return false;
+    pos_ += n;
+    return true;
+  }
+
+  JsonValue ParseValue() {
+    SkipSpace();
+    if (pos_ >= text_.size()) Fail("unexpected end of input");
+    JsonValue value;
+    char c = text_[pos_];
+    if (c == '{') {
+      value.type = JsonValue::Type::kObject;
+      pos_++;
+      SkipSpace();
+      if (pos_ < text_.size() && text_[pos_] == '}') {
+        pos_++;
+        return value;
+      }
+      do {
+        SkipSpace();
+        value.keys.push_back(ParseString());
+        Expect(':');
+        value.items.push_back(ParseValue());
+        SkipSpace();
+      } while (pos_ < text_.size() && text_[pos_++] == ',');
+      if (text_[pos_ - 1] != '}') Fail("expected '}'");
+    } else if (c == '[') {
+      value.type = JsonValue::Type::kArray;
+      pos_++;
+      SkipSpace();
+      if (pos_ < text_.size() && text_[pos_] == ']') {
+        pos_++;
+        return value;
+      }
+      do {
+        value.items.push_back(ParseValue());
+        SkipSpace();
+      } while (pos_ < text_.size() && text_[pos_++] == ',');
+      if (text_[pos_ - 1] != ']') Fail("expected ']'");
+    } else if (c == '"') {
+      value.type = JsonValue::Type::kString;
+      value.string = ParseString();
+    } else if (Consume("true")) {
+      value.type = JsonValue::Type::kBool;
+      value.boolean = true;
+    } else if (Consume("false")) {
+      value.type = JsonValue::Type::kBool;
+    } else if (Consume("null")) {
+      value.type = JsonValue::Type::kNull;
+    } else {
+      // Google Benchmark writes non-finite counters as bare inf / nan
+      const char *start = text_.c_str() + pos_;
+      char *end = nullptr;
+      value.type = JsonValue::Type::kNumber;
+      value.number = std::strtod(start, &end);
+      if (end == start) Fail("invalid value");
+      pos_ += static_cast<size_t>(end - start);
+    }
+    return value;
+  }
+
+  std::string ParseString() {
+    if (pos_ >= text_.size() || text_[pos_] != '"') Fail("expected string");
+    pos_++;
+    std::string out;
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      char c = text_[pos_++];
+      if (c != '\\') {
+        out += c;
+        continue;
+      }
+      if (pos_ >= text_.size()) break;
+      char e = text_[pos_++];
+      switch (e) {
+        case 'n': out += '\n'; break;
+        case 't': out += '\t'; break;
+        case 'r': out += '\r'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'u': {
+          if (pos_ + 4 > text_.size()) Fail("truncated \\u escape");
+          for (size_t i = pos_; i < pos_ + 4; ++i) {
+            if (!std::isxdigit(static_cast<unsigned char>(text_[i]))) Fail("bad \\u escape");
+          }
+          unsigned code = std::stoul(text_.substr(pos_, 4), nullptr, 16);
+          pos_ += 4;
+          out += code < 0x80 ? static_cast<char>(code) : '?';
+          break;
+        }
+        default: out += e; break; // \" \\ \/
+      }
+    }
+    if (pos_ >= text_.size()) Fail("unterminated string");
+    pos_++;
+    return out;
+  }
+
+  const std::string &text_;
+  size_t pos_ = 0;
+};
+
+//------------------------------------------------------------------------------
+// Result Files
+//------------------------------------------------------------------------------
+
+// Samples of one benchmark in one file, in nanoseconds
+struct BenchmarkSamples {
+  std::vector<double> times;
+  // From mean/stddev aggregates when the file has no iteration runs
+  double aggregate_mean = 0;
+  double aggregate_stddev = 0;
+  int aggregate_count = 0;
+  bool failed = false;
+};
+
+struct ResultFile {
+  std::string path;
+  std::string label; // File name without directory and extension
+  std::map<std::string, std::string> context;
+  std::vector<std::string> order; // Run names in file order
+  std::map<std::string, BenchmarkSamples> benchmarks;
+  size_t legacy_names = 0; // Runs renamed by CurrentRunName
+};
+
+double TimeUnitToNanoseconds(const std::string &unit) {
+  if (unit == "ns") return 1;
+  if (unit == "us") return 1e3;
+  if (unit == "ms") return 1e6;
+  if (unit == "s") return 1e9;
+  throw std::runtime_error("Unknown time_unit '" + unit + "'");
+}
+
+// The current name of a per-degree run written before the size tiers, e.g.
+// BM_NTL_Division/20 -> BM_NTL_Division/Large/20; any other name unchanged
+std::string CurrentRunName(const std::string &name) {
+  static const std::regex legacy(
+      "^(BM_(?:Givaro|Xgalois|NTL)_(?:Addition|Multiplication|Division|Inversion))"
+      "/([0-9]+)$");
+  std::smatch match;
+  if (!std::regex_match(name, match, legacy)) return name;
+  const int m = std::stoi(match[2].str());
+  const char *tier = m <= 8 ? "Small" : m <= 16 ? "Medium" : "Large";
+  return match[1].str() + "/" + tier + "/" + match[2].str();
+}
+
+ResultFile LoadResultFile(const std::string &path, const std::string &metric) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) throw std::runtime_error("Cannot open " + path);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string text = buffer.str();
+  JsonValue root;
+  try {
+    root = JsonParser(text).Parse();
+  } catch (const std::runtime_error &e) {
+    throw std::runtime_error(path + ": " + e.what());
+  }
+
+  ResultFile file;
+  file.path = path;
+  file.label = path.substr(path.find_last_of('/') + 1);
+  file.label = file.label.substr(0, file.label.rfind('.'));
+
+  if (const JsonValue *context = root.Find("context")) {
+    for (size_t i = 0; i < context->keys.size(); ++i) {
+      const JsonValue &v = context->items[i];
+      if (v.type == JsonValue::Type::kString) {
+        file.context[context->keys[i]] = v.string;
+      } else if (v.type == JsonValue::Type::kNumber) {
+        std::ostringstream os;
+        os << v.number;
+        file.context[context->keys[i]] = os.str();
+      }
+    }
+  }
+
+  const JsonValue *benchmarks = root.Find("benchmarks");
+  if (!benchmarks || benchmarks->type != JsonValue::Type::kArray) {
+    throw std::runtime_error(path + ": no \"benchmarks\" array");
+  }
+  for (const JsonValue &run : benchmarks->items) {
+    const std::string written = run.StringOr("run_name", run.StringOr("name", ""));
+    if (written.empty()) continue;
+    const std::string name = CurrentRunName(written);
+    if (name != written && !file.benchmarks.count(name)) ++file.legacy_names;
+    if (!file.benchmarks.count(name)) file.order.push_back(name);
+    BenchmarkSamples &samples = file.benchmarks[name];
+
+    const JsonValue *error = run.Find("error_occurred");
+    if (error && error->boolean) {
+      samples.failed = true;
+      continue;
+    }
+    const double scale = TimeUnitToNanoseconds(run.StringOr("time_unit", "ns"));
+    const double time = run.NumberOr(metric, NAN) * scale;
+    if (run.StringOr("run_type", "iteration") == "aggregate") {
+      const std::string aggregate = run.StringOr("aggregate_name", "");
+      if (aggregate == "mean") {
+        samples.aggregate_mean = time;
+        samples.aggregate_count = static_cast<int>(run.NumberOr("repetitions", 1));
+      } else if (aggregate == "stddev") {
+        samples.aggregate_stddev = time;
+      }
+    } else if (std::isfinite(time) && time > 0) {
+      samples.times.push_back(time);
+    }
+  }
+  return file;
+}
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+
+// Log-time summary of a sample set
+struct LogStats {
+  int n = 0;
+  double mean = 0;     // Mean of ln(time)
+  double variance = 0; // Sample variance of ln(time)
+};
+
+LogStats SummarizeLog(const BenchmarkSamples &samples) {
+  LogStats stats;
+  if (!samples.times.empty()) {
+    stats.n = static_cast<int>(samples.times.size());
+    for (double t : samples.times) stats.mean += std::log(t);
+    stats.mean /= stats.n;
+    for (double t : samples.times) {
+      double d = std::log(t) - stats.mean;
+      stats.variance += d * d;
+    }
+    stats.variance = stats.n > 1 ? stats.variance / (stats.n - 1) : 0;
+  } else if (samples.aggregate_count > 0 && samples.aggregate_mean > 0) {
+    // Delta method: Var[ln X] ~ (sd / mean)^2
+    stats.n = samples.aggregate_count;
+    double cv = samples.aggregate_stddev / samples.aggregate_mean;
+    stats.mean = std::log(samples.aggregate_mean) - cv * cv / 2;
+    stats.variance = cv * cv;
+  }
+  return stats;
+}
+
+// Continued fraction for the regularized incomplete beta function (modified
+// Lentz), valid for x < (a + 1) / (a + b + 2)
+double IncompleteBetaFraction(double a, double b, double x) {
+  const double tiny = 1e-300;
+  double c = 1;
+  double d = 1 - (a + b) * x / (a + 1);
+  d = 1 / (std::fabs(d) < tiny ? tiny : d);
+  double h = d;
+  for (int m = 1; m <= 300; ++m) {
+    double m2 = 2.0 * m;
+    double num = m * (b - m) * x / ((a + m2 - 1) * (a + m2));
+    d = 1 + num * d;
+    c = 1 + num / c;
+    d = 1 / (std::fabs(d) < tiny ? tiny : d);
+    c = std::fabs(c) < tiny ? tiny : c;
+    h *= d * c;
+    num = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1));
+    d = 1 + num * d;
+    c = 1 + num / c;
+    d = 1 / (std::fabs(d) < tiny ? tiny : d);
+    c = std::fabs(c) < tiny ? tiny : c;
+    double delta = d * c;
+    h *= delta;
+    if (std::fabs(delta - 1) < 1e-14) break;
+  }
+  return h;
+}
+
+// I_x(a, b)
+double RegularizedIncompleteBeta(double a, double b, double x) {
+  if (x <= 0) return 0;
+  if (x >= 1) return 1;
+  double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                          a * std::log(x) + b * std::log1p(-x));
+  if (x < (a + 1) / (a + b + 2)) {
+    return front * IncompleteBetaFraction(a, b, x) / a;
+  }
+  return 1 - front * IncompleteBetaFraction(b, a, 1 - x) / b;
+}
+
+// P(|T| > t) for Student's t with df degrees of freedom
+double StudentTwoSidedP(double t, double df) {
+  return RegularizedIncompleteBeta(df / 2, 0.5, df / (df + t * t));
+}
+
+// t such that P(|T| > t) = alpha
+double StudentQuantile(double alpha, double df) {
+  double lo = 0;
+  double hi = 1e6;
+  for (int i = 0; i < 200; ++i) {
+    double mid = (lo + hi) / 2;
+    if (StudentTwoSidedP(mid, df) > alpha) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  return (lo + hi) / 2;
+}
+
+enum class Verdict { kUnchanged, kImprovement, kRegression, kFaster, kSlower };
+
+const char *VerdictName(Verdict verdict) {
+  switch (verdict) {
+    case Verdict::kImprovement: return "improvement";
+    case Verdict::kRegression: return "**REGRESSION**";
+    case Verdict::kFaster: return "faster (untested)";
+    case Verdict::kSlower: return "slower (untested)";
+    default: return "unchanged";
+  }
+}
+
+// Candidate vs. baseline for one benchmark; speedup > 1 means the candidate
+// is faster
+struct Comparison {
+  std::string name;
+  double baseline_ns = 0; // Geometric mean
+  double candidate_ns = 0;
+  int baseline_n = 0;
+  int candidate_n = 0;
+  double speedup = 1;
+  bool tested = false; // Both sides have >= 2 samples
+  double ci_low = 0;
+  double ci_high = 0;
+  double p = 1;
+  Verdict verdict = Verdict::kUnchanged;
+};
+
+Comparison Compare(const std::string &name, const LogStats &base,
+                   const LogStats &cand, double alpha, double threshold) {
+  Comparison c;
+  c.name = name;
+  c.baseline_ns = std::exp(base.mean);
+  c.candidate_ns = std::exp(cand.mean);
+  c.baseline_n = base.n;
+  c.candidate_n = cand.n;
+  const double diff = base.mean - cand.mean; // ln(speedup)
+  c.speedup = std::exp(diff);
+
+  const bool beyond_noise =
+      c.speedup > 1 + threshold || c.speedup < 1 / (1 + threshold);
+  if (base.n < 2 || cand.n < 2) {
+    if (beyond_noise) c.verdict = c.speedup > 1 ? Verdict::kFaster : Verdict::kSlower;
+    return c;
+  }
+
+  // Welch's t-test on the log means, Welch-Satterthwaite degrees of freedom
+  const double vb = base.variance / base.n;
+  const double vc = cand.variance / cand.n;
+  const double se = std::sqrt(vb + vc);
+  c.tested = true;
+  if (se == 0) {
+    c.ci_low = c.ci_high = c.speedup;
+    c.p = diff == 0 ? 1 : 0;
+  } else {
+    const double df = (vb + vc) * (vb + vc) /
+                      (vb * vb / (base.n - 1) + vc * vc / (cand.n - 1));
+    const double t = StudentQuantile(alpha, df);
+    c.ci_low = std::exp(diff - t * se);
+    c.ci_high = std::exp(diff + t * se);
+    c.p = StudentTwoSidedP(std::fabs(diff) / se, df);
+  }
+  if (c.p < alpha && beyond_noise) {
+    c.verdict = c.speedup > 1 ? Verdict::kImprovement : Verdict::kRegression;
+  }
+  return c;
+}
+
+//------------------------------------------------------------------------------
+// Markdown Report
+//------------------------------------------------------------------------------
+
+struct ReportOptions {
+  std::string metric = "real_time";
+  double alpha = 0.05;
+  double threshold = 0.05;
+  std::string filter;
+  std::string output;
+};
+
+std::string FormatTime(double ns) {
+  char text[32];
+  if (ns < 1e3) {
+    std::snprintf(text, sizeof(text), "%.3g ns", ns);
+  } else if (ns < 1e6) {
+    std::snprintf(text, sizeof(text), "%.3g us", ns / 1e3);
+  } else if (ns < 1e9) {
+    std::snprintf(text, sizeof(text), "%.3g ms", ns / 1e6);
+  } else {
+    std::snprintf(text, sizeof(text), "%.3g s", ns / 1e9);
+  }
+  return text;
+}
+
+std::string FormatRatio(double ratio) {
+  char text[32];
+  std::snprintf(text, sizeof(text), "%.2fx", ratio);
+  return text;
+}
+
+// Benchmark family: the name up to the first argument
+std::string FamilyName(const std::string &name) {
+  return name.substr(0, name.find('/'));
+}
+
+std::string ContextValue(const ResultFile &file, const std::string &key) {
+  auto it = file.context.find(key);
+  return it == file.context.end() ? "-" : it->second;
+}
+
+// Writes the report; returns true when any candidate regressed
+bool WriteReport(std::ostream &out, const std::vector<ResultFile> &files,
+                 const ReportOptions &options) {
+  const ResultFile &base = files[0];
+  const std::regex filter(options.filter.empty() ? ".*" : options.filter);
+  const int confidence = static_cast<int>(std::lround(100 * (1 - options.alpha)));
+  bool regressed = false;
+
+  out << "# Benchmark Comparison Report\n\n";
+  out << "**Baseline:** `" << base.label << "`  \n";
+  out << "**Metric:** " << options.metric << " (geometric mean over repetitions)  \n";
+  out << "**Confidence:** " << confidence << "% (Welch t-test on log-times)  \n";
+  out << "**Noise threshold:** " << 100 * options.threshold << "%\n\n";
+  out << "Speedup is baseline time / candidate time, so values above 1.00x mean "
+         "the candidate is faster. Changes are flagged only when they are "
+         "significant and larger than the noise threshold.\n\n";
+
+  out << "## Runs\n\n";
+  out << "| Run | Date | Host | CPUs | Library | Build |\n";
+  out << "|-----|------|------|------|---------|-------|\n";
+  for (const ResultFile &file : files) {
+    out << "| `" << file.label << "` | " << ContextValue(file, "date") << " | "
+        << ContextValue(file, "host_name") << " | " << ContextValue(file, "num_cpus")
+        << " | " << ContextValue(file, "library_version") << " | "
+        << ContextValue(file, "library_build_type") << " |\n";
+  }
+  out << "\n";
+  for (const ResultFile &file : files) {
+    if (file.legacy_names == 0) continue;
+    out << "**Note:** `" << file.label << "` predates the size-tier benchmark names, so "
+        << file.legacy_names << " of its runs are matched as `<name>/<tier>/<m>`. "
+        << "Its m = 16 fields used the modulus x^16 + x^12 + x^3 + x + 1, not "
+        << "x^16 + x^5 + x^3 + x^2 + 1, so those rows compare different fields.\n\n";
+  }
+
+  for (size_t f = 1; f < files.size(); ++f) {
+    const ResultFile &cand = files[f];
+    std::vector<Comparison> comparisons;
+    std::vector<std::string> only_base;
+    std::vector<std::string> only_cand;
+    std::vector<std::string> failed;
+    for (const std::string &name : base.order) {
+      if (!std::regex_search(name, filter)) continue;
+      auto it = cand.benchmarks.find(name);
+      if (it == cand.benchmarks.end()) {
+        only_base.push_back(name);
+        continue;
+      }
+      const BenchmarkSamples &bs = base.benchmarks.at(name);
+      if (bs.failed || it->second.failed) {
+        failed.push_back(name);
+        continue;
+      }
+      LogStats b = SummarizeLog(bs);
+      LogStats c = SummarizeLog(it->second);
+      if (b.n == 0 || c.n == 0) {
+        failed.push_back(name);
+        continue;
+      }
+      comparisons.push_back(Compare(name, b, c, options.alpha, options.threshold));
+    }
+    for (const std::string &name : cand.order) {
+      if (std::regex_search(name, filter) && !base.benchmarks.count(name)) {
+        only_cand.push_back(name);
+      }
+    }
+
+    int counts[5] = {0, 0, 0, 0, 0};
+    double log_speedup = 0;
+    for (const Comparison &c : comparisons) {
+      counts[static_cast<int>(c.verdict)]++;
+      log_speedup += std::log(c.speedup);
+    }
+    regressed = regressed || counts[static_cast<int>(Verdict::kRegression)] > 0;
+
+    out << "## `" << cand.label << "` vs. `" << base.label << "`\n\n";
+    out << "| Matched | Geomean speedup | Improvements | Regressions | Unchanged | Untested faster | Untested slower |\n";
+    out << "|---------|-----------------|--------------|-------------|-----------|-----------------|-----------------|\n";
+    out << "| " << comparisons.size() << " | "
+        << (comparisons.empty() ? "-" : FormatRatio(std::exp(log_speedup / comparisons.size())))
+        << " | " << counts[static_cast<int>(Verdict::kImprovement)]
+        << " | " << counts[static_cast<int>(Verdict::kRegression)]
+        << " | " << counts[static_cast<int>(Verdict::kUnchanged)]
+        << " | " << counts[static_cast<int>(Verdict::kFaster)]
+        << " | " << counts[static_cast<int>(Verdict::kSlower)] << " |\n\n";
+
+    auto write_table = [&](const std::vector<const Comparison *> &rows) {
+      out << "| Benchmark | Baseline | Candidate | n | Speedup | " << confidence
+          << "% CI | p | Verdict |\n";
+      out << "|-----------|----------|-----------|---|---------|------|---|---------|\n";
+      for (const Comparison *c : rows) {
+        char p[32];
+        std::snprintf(p, sizeof(p), "%.3g", c->p);
+        out << "| `" << c->name << "` | " << FormatTime(c->baseline_ns) << " | "
+            << FormatTime(c->candidate_ns) << " | " << c->baseline_n << "/"
+            << c->candidate_n << " | " << FormatRatio(c->speedup) << " | "
+            << (c->tested ? FormatRatio(c->ci_low) + " - " + FormatRatio(c->ci_high) : "-")
+            << " | " << (c->tested ? p : "-") << " | " << VerdictName(c->verdict)
+            << " |\n";
+      }
+      out << "\n";
+    };
+
+    std::vector<const Comparison *> regressions;
+    for (const Comparison &c : comparisons) {
+      if (c.verdict == Verdict::kRegression) regressions.push_back(&c);
+    }
+    if (!regressions.empty()) {
+      out << "### Regressions\n\n";
+      write_table(regressions);
+    }
+
+    // One table per family, in baseline order
+    std::vector<const Comparison *> family_rows;
+    for (size_t i = 0; i < comparisons.size(); ++i) {
+      family_rows.push_back(&comparisons[i]);
+      const bool last = i + 1 == comparisons.size() ||
+                        FamilyName(comparisons[i + 1].name) != FamilyName(comparisons[i].name);
+      if (last) {
+        out << "### " << FamilyName(comparisons[i].name) << "\n\n";
+        write_table(family_rows);
+        family_rows.clear();
+      }
+    }
+
+    auto write_names = [&](const char *title, const std::vector<std::string> &names) {
+      if (names.empty()) return;
+      out << "### " << title << "\n\n";
+      for (const std::string &name : names) out << "- `" << name << "`\n";
+      out << "\n";
+    };
+    write_names("Only in baseline", only_base);
+    write_names("Only in candidate", only_cand);
+    write_names("Failed or without samples", failed);
+  }
+  return regressed;
+}
+
+//------------------------------------------------------------------------------
+// Main
+//------------------------------------------------------------------------------
+
+void PrintUsage(const char *program) {
+  std::cerr
+      << "Usage: " << program << " [options] BASELINE.json CANDIDATE.json...\n"
+      << "\n"
+      << "Options:\n"
+      << "  --metric NAME      real_time or cpu_time (default: real_time)\n"
+      << "  --alpha A          Significance level (default: 0.05)\n"
+      << "  --threshold T      Smallest relative change to flag (default: 0.05)\n"
+      << "  --filter REGEX     Only compare benchmarks whose name matches\n"
+      << "  -o, --output FILE  Write the report to FILE instead of stdout\n"
+      << "\n"
+      << "Exits 1 when a candidate has a significant regression, 2 on error.\n";
+}
+
+int main(int argc, char **argv) {
+  ReportOptions options;
+  std::vector<std::string> paths;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      auto value = [&]() -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument(arg + " needs a value");
+        return argv[++i];
+      };
+      if (arg == "-h" || arg == "--help") {
+        PrintUsage(argv[0]);
+        return 0;
+      } else if (arg == "--metric") {
+        options.metric = value();
+        if (options.metric != "real_time" && options.metric != "cpu_time") {
+          throw std::invalid_argument("--metric must be real_time or cpu_time");
+        }
+      } else if (arg == "--alpha") {
+        options.alpha = std::stod(value());
+        if (!(options.alpha > 0 && options.alpha < 1)) {
+          throw std::invalid_argument("--alpha must be in (0, 1)");
+        }
+      } else if (arg == "--threshold") {
+        options.threshold = std::stod(value());
+        if (!(options.threshold >= 0)) {
+          throw std::invalid_argument("--threshold must be >= 0");
+        }
+      } else if (arg == "--filter") {
+        options.filter = value();
+      } else if (arg == "-o" || arg == "--output") {
+        options.output = value();
+      } else if (!arg.empty() && arg[0] == '-') {
+        throw std::invalid_argument("Unknown option " + arg);
+      } else {
+        paths.push_back(arg);
+      }
+    }
+    if (paths.size() < 2) {
+      throw std::invalid_argument("Need a baseline and at least one candidate");
+    }
+
+    std::vector<ResultFile> files;
+    for (const std::string &path : paths) {
+      files.push_back(LoadResultFile(path, options.metric));
+    }
+
+    bool regressed;
+    if (options.output.empty()) {
+      regressed = WriteReport(std::cout, files, options);
+    } else {
+      std::ofstream out(options.output);
+      if (!out) throw std::runtime_error("Cannot write " + options.output);
+      regressed = WriteReport(out, files, options);
+    }
+    return regressed ? 1 : 0;
+  } catch (const std::invalid_argument &e) {
+    std::cerr << "Error: " << e.what() << "\n\n";
+    PrintUsage(argv[0]);
+    return 2;
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 2;
+  }
+}
@@ -24,6 +24,8 @@ BENCHMARK_TIME="1.0"
 OUTPUT_FORMAT="json"
 RESULTS_DIR="results"
 BENCHMARK_FILTER=""
+BENCHMARK_REPETITIONS=""
+COMPARE_BASELINE=""
 
 # Function to print usage
 print_usage() {
@@ -35,7 +37,7 @@ print_usage() {
     echo "  1  - All benchmarks (default)"
     echo "  2  - Small field tests only (GF(2^2) to GF(2^8))"
     echo "  3  - Medium field tests only (GF(2^9) to GF(2^16))"
-    echo "  4  - Large field tests only (GF(2^17) to GF(2^20))"
+    echo "  4  - Large field tests only (GF(2^17) to GF(2^32))"
     echo "  5  - Addition tests only (all field sizes)"
     echo "  6  - Multiplication tests only (all field sizes)"
     echo "  7  - Division tests only (all field sizes)"
@@ -44,11 +46,29 @@ print_usage() {
     echo "  10 - Field construction tests only (all field sizes)"
     echo "  11 - Quick test (0.1s per benchmark)"
     echo "  12 - Memory usage analysis"
+    echo "  13 - Bulk throughput tests only (1K to 16M element buffers)"
+    echo "  14 - Region multiply tests only (SIMD split-table vs. library loops)"
+    echo "  15 - Carry-less multiply tests only (CLMUL vs. NTL, m up to 233)"
+    echo "  16 - Reed-Solomon encode/reconstruct tests only (MB/s per backend)"
+    echo "  17 - Multi-threaded scaling tests only (shared vs. per-thread fields)"
+    echo "  18 - Latency vs. throughput tests only (dependent chain vs. independent ops)"
+    echo "  19 - Working-set / cache-pressure sweep only (table backends, m = 8..24)"
+    echo "  20 - Polynomial arithmetic tests only (schoolbook vs. Karatsuba / Newton, degree 16..65536)"
+    echo "  21 - Matrix kernel tests only (mat-vec, multiply, inversion; naive vs. cache-blocked)"
+    echo "       n = 8..4096 for mat-vec, 8..512 for multiply/inversion (NTL: 1024 and 128)"
+    echo "  22 - Bitsliced arithmetic tests only (64/256-lane batches vs. Givaro/xgalois, m = 4..16)"
+    echo "  23 - Table layout tests only (16/32-bit entries, half Zech table, interleaved log/antilog)"
+    echo "  24 - Batch inversion/division tests only (Montgomery's trick vs. element-wise, n = 4..64K)"
+    echo "  25 - Tower field tests only (GF(2^16)/GF(2^32) over GF(2^8) vs. direct tables and CLMUL)"
+    echo "  26 - Normal basis tests only (square, square root, mul, inv; Gaussian normal basis vs. all backends)"
+    echo "  27 - Trace / half-trace / quadratic solver tests only (field arithmetic vs. precomputed linear maps)"
     echo ""
     echo -e "${YELLOW}OPTIONS:${NC}"
     echo "  -t, --time TIME      Set benchmark time per test (default: 1.0s)"
     echo "  -f, --format FORMAT  Output format: console, json, csv (default: csv)"
     echo "  -o, --output DIR     Output directory (default: $RESULTS_DIR)"
+    echo "  -r, --repetitions N  Repeat each benchmark N times (needed for confidence intervals)"
+    echo "  -c, --compare FILE   Compare the JSON results against baseline FILE (Markdown report)"
     echo "  -h, --help          Show this help message"
     echo ""
     echo -e "${YELLOW}EXAMPLES:${NC}"
@@ -56,6 +76,7 @@ print_usage() {
     echo "  $0 2 --time 2.0                # Run small field tests for 2s each"
     echo "  $0 5 --format json             # Run addition tests with JSON output"
     echo "  $0 11                          # Quick test run"
+    echo "  $0 6 -r 10 -c results/old.json # Multiplication, compared against a baseline"
     echo ""
 }
 
@@ -87,10 +108,18 @@ build_benchmark() {
     # Compile directly with clang++
     echo -e "${YELLOW}Compiling with clang++...${NC}"
 
+    # gfb::GF2mClmul inlines PCLMULQDQ only when the compiler targets it;
+    # arm64 targets enable PMULL by default
+    local arch_flags=""
+    if [ "$(uname -m)" = "x86_64" ]; then
+        arch_flags="-mpclmul"
+    fi
+
     /usr/bin/clang++ \
         -std=c++23 \
         -O3 \
         -DNDEBUG \
+        $arch_flags \
         -I/opt/homebrew/include \
         -I/Users/amirmulla/Desktop/gf_benchmark \
         -I/Users/amirmulla/xgalois \
@@ -111,6 +140,17 @@ build_benchmark() {
     echo -e "${GREEN}Benchmark built successfully${NC}"
 }
 
+# Function to build the result comparison tool
+build_compare_tool() {
+    echo -e "${YELLOW}Building compare_results...${NC}"
+    /usr/bin/clang++ -std=c++23 -O2 compare_results.cpp -o compare_results
+
+    if [ ! -f "compare_results" ]; then
+        echo -e "${RED}Error: Failed to build compare_results${NC}"
+        exit 1
+    fi
+}
+
 # Function to run benchmark with specified parameters
 run_benchmark() {
     local test_name="$1"
@@ -137,6 +177,11 @@ run_benchmark() {
             ;;
     esac
 
+    # Repetitions give the comparison report its confidence intervals
+    if [ -n "$BENCHMARK_REPETITIONS" ]; then
+        benchmark_args="$benchmark_args --benchmark_repetitions=$BENCHMARK_REPETITIONS"
+    fi
+
     # Set filter if provided
     if [ -n "$filter" ]; then
         benchmark_args="$benchmark_args --benchmark_filter=$filter"
@@ -180,11 +225,19 @@ while [[ $# -gt 0 ]]; do
             RESULTS_DIR="$2"
             shift 2
             ;;
+        -r|--repetitions)
+            BENCHMARK_REPETITIONS="$2"
+            shift 2
+            ;;
+        -c|--compare)
+            COMPARE_BASELINE="$2"
+            shift 2
+            ;;
         -h|--help)
             print_usage
             exit 0
             ;;
-        [1-9]|1[0-2])
+        [1-9]|1[0-9]|2[0-7])
             TEST_TYPE=$1
             shift
             ;;
@@ -207,6 +260,18 @@ case "$OUTPUT_FORMAT" in
         ;;
 esac
 
+# The comparison reads JSON results
+if [ -n "$COMPARE_BASELINE" ]; then
+    if [ ! -f "$COMPARE_BASELINE" ]; then
+        echo -e "${RED}Baseline not found: $COMPARE_BASELINE${NC}"
+        exit 1
+    fi
+    if [ "$OUTPUT_FORMAT" != "json" ]; then
+        echo -e "${RED}--compare needs --format json${NC}"
+        exit 1
+    fi
+fi
+
 # Main execution
 echo -e "${GREEN}Starting Givaro Binary Extension Field Benchmarks${NC}"
 echo "Test Type: $TEST_TYPE"
@@ -218,6 +283,9 @@ echo ""
 get_system_info
 create_results_dir
 build_benchmark
+if [ -n "$COMPARE_BASELINE" ]; then
+    build_compare_tool
+fi
 
 # Get timestamp for result files
 TIMESTAMP=$(date +"%Y%m%d_%H%M%S")
@@ -237,31 +305,31 @@ case $TEST_TYPE in
         ;;
     2) # Small field tests
         echo -e "${BLUE}Running small field tests (GF(2^2) to GF(2^8))...${NC}"
-        run_benchmark "Small Field Tests" "Small" "$OUTPUT_FILE"
+        run_benchmark "Small Field Tests" "/Small/" "$OUTPUT_FILE"
         ;;
     3) # Medium field tests
         echo -e "${BLUE}Running medium field tests (GF(2^9) to GF(2^16))...${NC}"
-        run_benchmark "Medium Field Tests" "Medium" "$OUTPUT_FILE"
+        run_benchmark "Medium Field Tests" "/Medium/" "$OUTPUT_FILE"
         ;;
     4) # Large field tests
-        echo -e "${BLUE}Running large field tests (GF(2^17) to GF(2^20))...${NC}"
-        run_benchmark "Large Field Tests" "Large" "$OUTPUT_FILE"
+        echo -e "${BLUE}Running large field tests (GF(2^17) to GF(2^32))...${NC}"
+        run_benchmark "Large Field Tests" "/Large/" "$OUTPUT_FILE"
         ;;
     5) # Addition tests
         echo -e "${BLUE}Running addition tests (all field sizes)...${NC}"
-        run_benchmark "Addition Tests" "Addition" "$OUTPUT_FILE"
+        run_benchmark "Addition Tests" "^BM_[A-Za-z]+_Addition/" "$OUTPUT_FILE"
         ;;
     6) # Multiplication tests
         echo -e "${BLUE}Running multiplication tests (all field sizes)...${NC}"
-        run_benchmark "Multiplication Tests" "Multiplication" "$OUTPUT_FILE"
+        run_benchmark "Multiplication Tests" "^BM_[A-Za-z]+_Multiplication/" "$OUTPUT_FILE"
         ;;
     7) # Division tests
         echo -e "${BLUE}Running division tests (all field sizes)...${NC}"
-        run_benchmark "Division Tests" "Division" "$OUTPUT_FILE"
+        run_benchmark "Division Tests" "^BM_[A-Za-z]+_Division/" "$OUTPUT_FILE"
         ;;
     8) # Inversion tests
         echo -e "${BLUE}Running inversion tests (all field sizes)...${NC}"
-        run_benchmark "Inversion Tests" "Inversion" "$OUTPUT_FILE"
+        run_benchmark "Inversion Tests" "^BM_[A-Za-z]+_Inversion/" "$OUTPUT_FILE"
         ;;
     9) # Exponentiation tests
         echo -e "${BLUE}Running exponentiation tests (all field sizes)...${NC}"
@@ -278,19 +346,88 @@ case $TEST_TYPE in
         ;;
     12) # Memory usage analysis
         echo -e "${BLUE}Running memory usage analysis...${NC}"
-        OUTPUT_FORMAT="csv"
-        OUTPUT_FILE="$RESULTS_DIR/givaro_memory_analysis_${TIMESTAMP}.csv"
-        run_benchmark "Memory Usage Analysis" "" "$OUTPUT_FILE"
+        # JSON, since the per-backend counter sets differ (CSV needs one set)
+        OUTPUT_FORMAT="json"
+        OUTPUT_FILE="$RESULTS_DIR/givaro_memory_analysis_${TIMESTAMP}.json"
+        # The per-op benchmarks report the footprint of one field instance
+        run_benchmark "Memory Usage Analysis" "^BM_[A-Za-z]+_(Addition|Multiplication|Division|Inversion)/" "$OUTPUT_FILE"
 
-        # Generate memory usage report
+        # Generate memory usage report: one line per backend and degree
         if [ -f "$OUTPUT_FILE" ]; then
             echo -e "${YELLOW}Generating memory usage report...${NC}"
             echo "Memory Usage Summary:" > "$RESULTS_DIR/memory_summary_${TIMESTAMP}.txt"
             echo "===================" >> "$RESULTS_DIR/memory_summary_${TIMESTAMP}.txt"
-            grep "MemoryPeak_KB" "$OUTPUT_FILE" | head -20 >> "$RESULTS_DIR/memory_summary_${TIMESTAMP}.txt"
+            echo "benchmark FieldHeapBytes FieldAllocations FieldRSSDelta_KB" >> "$RESULTS_DIR/memory_summary_${TIMESTAMP}.txt"
+            awk -F'[:,]' '
+                /"name":/ { gsub(/[ "]/, "", $2); name = $2 }
+                /"FieldAllocations":/ { allocations = $2 + 0 }
+                /"FieldHeapBytes":/ { heap = $2 + 0 }
+                /"FieldRSSDelta_KB":/ && name ~ /_Multiplication\// {
+                    print name, heap, allocations, $2 + 0
+                }' "$OUTPUT_FILE" >> "$RESULTS_DIR/memory_summary_${TIMESTAMP}.txt"
             echo -e "${GREEN}Memory summary saved to: $RESULTS_DIR/memory_summary_${TIMESTAMP}.txt${NC}"
         fi
         ;;
+    13) # Bulk throughput tests
+        echo -e "${BLUE}Running bulk throughput tests (1K to 16M element buffers)...${NC}"
+        run_benchmark "Bulk Throughput Tests" "_Bulk" "$OUTPUT_FILE"
+        ;;
+    14) # Region multiply tests
+        echo -e "${BLUE}Running region multiply tests (SIMD split-table vs. library loops)...${NC}"
+        run_benchmark "Region Multiply Tests" "Region" "$OUTPUT_FILE"
+        ;;
+    15) # Carry-less multiply tests
+        echo -e "${BLUE}Running carry-less multiply tests (CLMUL vs. NTL, m up to 233)...${NC}"
+        run_benchmark "Carry-less Multiply Tests" "Clmul_(Multiplication|Division|Inversion)/|ClmulWide_|NTL_Large" "$OUTPUT_FILE"
+        ;;
+    16) # Reed-Solomon tests
+        echo -e "${BLUE}Running Reed-Solomon encode/reconstruct tests (MB/s per backend)...${NC}"
+        run_benchmark "Reed-Solomon Tests" "RSEncode|RSReconstruct" "$OUTPUT_FILE"
+        ;;
+    17) # Multi-threaded scaling tests
+        echo -e "${BLUE}Running multi-threaded scaling tests (shared vs. per-thread fields)...${NC}"
+        run_benchmark "Multi-threaded Scaling Tests" "_Threaded" "$OUTPUT_FILE"
+        ;;
+    18) # Latency vs. throughput tests
+        echo -e "${BLUE}Running latency vs. throughput tests (dependent chain vs. independent ops)...${NC}"
+        run_benchmark "Latency and Throughput Tests" "_Latency/|_Throughput/" "$OUTPUT_FILE"
+        ;;
+    19) # Working-set / cache-pressure sweep
+        echo -e "${BLUE}Running working-set / cache-pressure sweep (table backends, m = 8..24)...${NC}"
+        run_benchmark "Cache Pressure Tests" "CacheSweep" "$OUTPUT_FILE"
+        ;;
+    20) # Polynomial arithmetic tests
+        echo -e "${BLUE}Running polynomial arithmetic tests (schoolbook vs. Karatsuba / Newton, degree 16..65536)...${NC}"
+        run_benchmark "Polynomial Arithmetic Tests" "_Poly" "$OUTPUT_FILE"
+        ;;
+    21) # Matrix kernel tests
+        echo -e "${BLUE}Running matrix kernel tests (mat-vec, multiply, inversion; naive vs. cache-blocked)...${NC}"
+        run_benchmark "Matrix Kernel Tests" "_Mat(Vec|Mul|Invert)" "$OUTPUT_FILE"
+        ;;
+    22) # Bitsliced arithmetic tests
+        echo -e "${BLUE}Running bitsliced arithmetic tests (64/256-lane batches vs. Givaro/xgalois, m = 4..16)...${NC}"
+        run_benchmark "Bitsliced Arithmetic Tests" "BM_Bitslice|_BitsliceBaseline" "$OUTPUT_FILE"
+        ;;
+    23) # Table layout tests
+        echo -e "${BLUE}Running table layout tests (16/32-bit entries, half Zech table, interleaved log/antilog)...${NC}"
+        run_benchmark "Table Layout Tests" "BM_TableLayout_" "$OUTPUT_FILE"
+        ;;
+    24) # Batch inversion/division tests
+        echo -e "${BLUE}Running batch inversion/division tests (Montgomery's trick vs. element-wise, n = 4..64K)...${NC}"
+        run_benchmark "Batch Inversion Tests" "_Batch(Inversion|Division)/" "$OUTPUT_FILE"
+        ;;
+    25) # Tower field tests
+        echo -e "${BLUE}Running tower field tests (GF(2^16)/GF(2^32) over GF(2^8) vs. direct tables and CLMUL)...${NC}"
+        run_benchmark "Tower Field Tests" "BM_Tower_|BM_Clmul_Bulk|_(Addition|Multiplication|Division|Inversion)/(Medium/16|Large/32)$|_Bulk[A-Za-z]+/16/|_CacheSweep/[A-Za-z]+/16/" "$OUTPUT_FILE"
+        ;;
+    26) # Normal basis tests
+        echo -e "${BLUE}Running normal basis tests (square, square root, mul, inv; Gaussian normal basis vs. all backends)...${NC}"
+        run_benchmark "Normal Basis Tests" "_Square(Root)?/|BM_Normal_|_(Multiplication|Inversion)/[A-Za-z]+/(4|12|20|23|28|29|31)$" "$OUTPUT_FILE"
+        ;;
+    27) # Trace and quadratic solver tests
+        echo -e "${BLUE}Running trace / half-trace / quadratic solver tests (field arithmetic vs. precomputed linear maps)...${NC}"
+        run_benchmark "Trace and Quadratic Solver Tests" "_(Trace|HalfTrace|QuadraticSolve)/" "$OUTPUT_FILE"
+        ;;
     *)
         echo -e "${RED}Invalid test type: $TEST_TYPE${NC}"
         print_usage
@@ -308,6 +445,20 @@ if [ -n "$OUTPUT_FILE" ] && [ -f "$OUTPUT_FILE" ]; then
     echo -e "${YELLOW}File size: $(ls -lh "$OUTPUT_FILE" | awk '{print $5}')${NC}"
 fi
 
+# Compare against the baseline; compare_results exits 1 on a regression
+if [ -n "$COMPARE_BASELINE" ] && [ -f "$OUTPUT_FILE" ]; then
+    REPORT_FILE="$RESULTS_DIR/benchmark_comparison_report_${TIMESTAMP}.md"
+    echo ""
+    echo -e "${YELLOW}Comparing against $COMPARE_BASELINE...${NC}"
+    COMPARE_STATUS=0
+    ./compare_results -o "$REPORT_FILE" "$COMPARE_BASELINE" "$OUTPUT_FILE" || COMPARE_STATUS=$?
+    case $COMPARE_STATUS in
+        0) echo -e "${GREEN}No significant regressions. Report: $REPORT_FILE${NC}" ;;
+        1) echo -e "${RED}Significant regressions found. Report: $REPORT_FILE${NC}" ;;
+        *) echo -e "${RED}Comparison failed${NC}" ;;
+    esac
+fi
+
 echo ""
 echo -e "${BLUE}Quick Performance Summary:${NC}"
 if [ -f "$OUTPUT_FILE" ] && [ "$OUTPUT_FORMAT" = "csv" ]; then
@@ -1,9 +1,11 @@
-#include <benchmark/benchmark.h>
 #include <chrono>
 #include <iostream>
 #include <random>
 #include <vector>
 #include <givaro/gfq.h>
+#include <gfb/field/gf2m_modulus.hpp>
+#include <gfb/field/gf2m_zech.hpp>
+#include <gfb/perf/operand_corpus.hpp>
 
 using namespace Givaro;
 
@@ -13,8 +15,9 @@ int main() {
 
     std::cout << "Creating GF(2^" << static_cast<int>(m) << ") using Givaro..." << std::endl;
 
-    // Create the field using Givaro's GF(2^m) implementation
-    GFq<uint64_t> field(2, m);
+    // Create the field using Givaro's GF(2^m) implementation, on the same
+    // modulus as the Zech comparison
+    GFq<uint64_t> field = gfb::MakeGivaroField(m);
 
     std::cout << "Field order: " << field.cardinality() << std::endl;
     std::cout << "Field characteristic: " << field.characteristic() << std::endl;
@@ -28,9 +31,14 @@ int main() {
     elements.reserve(num_elements);
 
     std::cout << "Generating " << num_elements << " random field elements..." << std::endl;
+    // Shared operand corpus (gfb/perf/operand_corpus.hpp): the same values as
+    // mt19937(42) over this range, mapped from disk after the first run
+    const gfb::OperandCorpus corpus = gfb::OpenOperandCorpus(
+        gfb::DefaultOperandCorpusDirectory(), m,
+        gfb::OperandDistribution::kNonzero, 42, num_elements);
     for (size_t i = 0; i < num_elements; ++i) {
         GFq<uint64_t>::Element elem;
-        field.init(elem, dis(gen));
+        field.init(elem, corpus[i]);
         elements.push_back(elem);
     }
 
@@ -59,6 +67,7 @@ int main() {
     // Calculate performance metrics
     double total_time_ms = duration.count() / 1e6;
     double avg_time_ns = static_cast<double>(duration.count()) / (elements.size() - 1);
+    double avg_pairs_ns = avg_time_ns;
     double operations_per_second = 1e9 / avg_time_ns;
 
     // Display results
@@ -108,7 +117,7 @@ int main() {
     std::cout << "\n=== Performance Comparison Across Field Sizes ===" << std::endl;
 
     for (uint8_t test_m : {4, 6, 8, 10, 12}) {
-        GFq<uint64_t> test_field(2, test_m);
+        GFq<uint64_t> test_field = gfb::MakeGivaroField(test_m);
 
         // Generate some test elements
         std::uniform_int_distribution<uint64_t> test_dis(1, test_field.cardinality() - 1);
@@ -167,6 +176,62 @@ int main() {
     std::cout << "Average time per inverse: " << avg_time_ns << " ns" << std::endl;
     std::cout << "Inverse operations per second: " << static_cast<uint64_t>(operations_per_second) << std::endl;
     
+    // Compare against the in-tree Zech-log engine on the same operand values
+    std::cout << "\n=== In-tree Zech (gfb::GF2mZech) Division Comparison ===" << std::endl;
+    gfb::WithGF2mZech(m, gfb::FindPrimitiveModulus(m), [&](const auto &zech) {
+        using ZechElement = decltype(zech.Zero());
+
+        // The corpus values the Givaro operands were built from
+        std::vector<ZechElement> zech_elements;
+        zech_elements.reserve(num_elements);
+        for (size_t i = 0; i < num_elements; ++i) {
+            zech_elements.push_back(zech.FromPolynomial(corpus[i]));
+        }
+
+        auto zech_start = std::chrono::high_resolution_clock::now();
+
+        for (size_t i = 0; i < zech_elements.size() - 1; ++i) {
+            ZechElement result = zech.Div(zech_elements[i], zech_elements[i + 1]);
+            // Prevent compiler optimization
+            volatile auto dummy = result;
+            (void)dummy;
+        }
+
+        auto zech_end = std::chrono::high_resolution_clock::now();
+        auto zech_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(zech_end - zech_start);
+        double zech_avg_ns = static_cast<double>(zech_duration.count()) / (zech_elements.size() - 1);
+
+        std::cout << "Table bytes: " << zech.TableBytes() << std::endl;
+        std::cout << "Average time per division: " << zech_avg_ns << " ns" << std::endl;
+        std::cout << "Speedup vs Givaro: " << avg_pairs_ns / zech_avg_ns << "x" << std::endl;
+    });
+
+    for (uint8_t test_m : {4, 6, 8, 10, 12}) {
+        gfb::WithGF2mZech(test_m, gfb::FindPrimitiveModulus(test_m), [&](const auto &zech) {
+            std::uniform_int_distribution<uint64_t> test_dis(1, zech.Order() - 1);
+            auto test_a = zech.FromPolynomial(test_dis(gen));
+            auto test_b = zech.FromPolynomial(test_dis(gen));
+
+            constexpr uint64_t test_operations = 100000;
+
+            auto zech_start = std::chrono::high_resolution_clock::now();
+
+            for (uint64_t i = 0; i < test_operations; ++i) {
+                auto result = zech.Div(test_a, test_b);
+                // Prevent compiler optimization
+                volatile auto dummy = result;
+                (void)dummy;
+            }
+
+            auto zech_end = std::chrono::high_resolution_clock::now();
+            auto zech_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(zech_end - zech_start);
+            double zech_avg_ns = static_cast<double>(zech_duration.count()) / test_operations;
+
+            std::cout << "Zech GF(2^" << static_cast<int>(test_m) << ") [Order: " << zech.Order() << "]: "
+                      << zech_avg_ns << " ns/op" << std::endl;
+        });
+    }
+
     std::cout << "\nDivision simulation completed successfully!" << std::endl;
     return 0;
 }
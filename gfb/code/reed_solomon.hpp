@@ -0,0 +1,268 @@
+/**
+ * @file reed_solomon.hpp
+ * @brief Systematic Reed-Solomon erasure code over a pluggable GF(2^m) field
+ *
+ * A stripe is k data shards followed by m parity shards of equal length.
+ * Parity is P * data for an m x k coding matrix chosen so that every k x k
+ * submatrix of [I; P] is invertible, hence any k surviving shards recover
+ * the stripe. Two constructions are provided:
+ *  - Vandermonde: V * inverse(top k rows of V) for V[i][j] = i^j, which
+ *    makes the top block the identity;
+ *  - Cauchy: P[i][j] = 1 / (x_i + y_j) with x_i = k + i, y_j = j.
+ *
+ * The codec is templated on a field adapter so the same encoder and decoder
+ * run over different backends. The adapter is a small Givaro-style interface
+ * with output parameters, so heavyweight elements (e.g. NTL::GF2E) are not
+ * copied in the inner loop:
+ *
+ *   using Element = ...;
+ *   uint64_t Order() const;
+ *   void Init(Element &r, uint32_t value) const;  // from polynomial basis
+ *   bool IsZero(const Element &a) const;
+ *   void Add(Element &r, const Element &a, const Element &b) const;
+ *   void Mul(Element &r, const Element &a, const Element &b) const;
+ *   void MulAdd(Element &r, const Element &a, const Element &x) const;
+ *   void Inv(Element &r, const Element &a) const;
+ *
+ * MulAdd computes r += a * x.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gfb {
+
+enum class RSMatrix { kVandermonde, kCauchy };
+
+inline const char *RSMatrixName(RSMatrix matrix) {
+  return matrix == RSMatrix::kVandermonde ? "vandermonde" : "cauchy";
+}
+
+template <typename Field> class ReedSolomon {
+public:
+  using Element = typename Field::Element;
+
+  // Shards are processed in blocks of this many symbols so one block of every
+  // input stays cache resident while all output rows are produced
+  static constexpr size_t kBlockSymbols = 4096;
+
+  // The field must outlive the codec
+  ReedSolomon(const Field &field, size_t data_shards, size_t parity_shards,
+              RSMatrix matrix = RSMatrix::kCauchy)
+      : field_(field), k_(data_shards), m_(parity_shards), matrix_(matrix) {
+    if (k_ == 0 || m_ == 0) {
+      throw std::invalid_argument("ReedSolomon: need data and parity shards");
+    }
+    if (k_ + m_ > field.Order()) {
+      throw std::invalid_argument("ReedSolomon: too many shards for field");
+    }
+    if (matrix == RSMatrix::kVandermonde) {
+      BuildVandermonde();
+    } else {
+      BuildCauchy();
+    }
+  }
+
+  size_t DataShards() const { return k_; }
+  size_t ParityShards() const { return m_; }
+  size_t TotalShards() const { return k_ + m_; }
+  RSMatrix Matrix() const { return matrix_; }
+
+  // Coding matrix entry for parity shard `row` and data shard `col`
+  const Element &Coefficient(size_t row, size_t col) const {
+    return parity_[row * k_ + col];
+  }
+
+  // parity[i][s] = sum_j P[i][j] * data[j][s] for s < len
+  void Encode(const Element *const *data, Element *const *parity,
+              size_t len) const {
+    ApplyMatrix(parity_.data(), m_, data, parity, len);
+  }
+
+  // Rebuilds the shards whose `present` flag is false, data first and then
+  // parity. shards holds all k + m buffers; missing ones are overwritten.
+  // Throws std::invalid_argument when fewer than k shards are present.
+  void Reconstruct(Element *const *shards, const std::vector<bool> &present,
+                   size_t len) const {
+    const size_t n = k_ + m_;
+    if (present.size() != n) {
+      throw std::invalid_argument("ReedSolomon: present mask has wrong size");
+    }
+
+    std::vector<size_t> missing_data;
+    for (size_t j = 0; j < k_; ++j) {
+      if (!present[j]) missing_data.push_back(j);
+    }
+
+    if (!missing_data.empty()) {
+      // The first k surviving shards and their rows of [I; P]
+      std::vector<size_t> survivors;
+      for (size_t i = 0; i < n && survivors.size() < k_; ++i) {
+        if (present[i]) survivors.push_back(i);
+      }
+      if (survivors.size() < k_) {
+        throw std::invalid_argument("ReedSolomon: too many erasures");
+      }
+
+      std::vector<Element> sub(k_ * k_);
+      for (size_t r = 0; r < k_; ++r) {
+        size_t shard = survivors[r];
+        for (size_t c = 0; c < k_; ++c) {
+          if (shard < k_) {
+            field_.Init(sub[r * k_ + c], shard == c ? 1 : 0);
+          } else {
+            sub[r * k_ + c] = Coefficient(shard - k_, c);
+          }
+        }
+      }
+      std::vector<Element> decode = Invert(std::move(sub), k_);
+
+      // Only the rows of the inverse for missing data shards are needed
+      std::vector<Element> rows(missing_data.size() * k_);
+      std::vector<Element *> outputs(missing_data.size());
+      for (size_t r = 0; r < missing_data.size(); ++r) {
+        std::copy_n(&decode[missing_data[r] * k_], k_, &rows[r * k_]);
+        outputs[r] = shards[missing_data[r]];
+      }
+      std::vector<const Element *> inputs(k_);
+      for (size_t r = 0; r < k_; ++r) inputs[r] = shards[survivors[r]];
+      ApplyMatrix(rows.data(), missing_data.size(), inputs.data(),
+                  outputs.data(), len);
+    }
+
+    // All data is present now; re-encode the missing parity rows
+    std::vector<Element> rows;
+    std::vector<Element *> outputs;
+    for (size_t i = 0; i < m_; ++i) {
+      if (present[k_ + i]) continue;
+      rows.insert(rows.end(), &parity_[i * k_], &parity_[i * k_] + k_);
+      outputs.push_back(shards[k_ + i]);
+    }
+    if (!outputs.empty()) {
+      ApplyMatrix(rows.data(), outputs.size(), shards, outputs.data(), len);
+    }
+  }
+
+private:
+  // outputs[r] = sum_j rows[r][j] * inputs[j], one block of symbols at a time
+  void ApplyMatrix(const Element *rows, size_t row_count,
+                   const Element *const *inputs, Element *const *outputs,
+                   size_t len) const {
+    for (size_t start = 0; start < len; start += kBlockSymbols) {
+      size_t end = std::min(len, start + kBlockSymbols);
+      for (size_t r = 0; r < row_count; ++r) {
+        const Element *row = rows + r * k_;
+        Element *out = outputs[r];
+        const Element *in = inputs[0];
+        for (size_t s = start; s < end; ++s) {
+          field_.Mul(out[s], row[0], in[s]);
+        }
+        for (size_t j = 1; j < k_; ++j) {
+          in = inputs[j];
+          for (size_t s = start; s < end; ++s) {
+            field_.MulAdd(out[s], row[j], in[s]);
+          }
+        }
+      }
+    }
+  }
+
+  // Gauss-Jordan inverse of the n x n row-major matrix a. Throws when a is
+  // singular, which cannot happen for submatrices of an MDS generator.
+  std::vector<Element> Invert(std::vector<Element> a, size_t n) const {
+    std::vector<Element> inv(n * n);
+    for (size_t r = 0; r < n; ++r) {
+      for (size_t c = 0; c < n; ++c) field_.Init(inv[r * n + c], r == c);
+    }
+
+    Element scale, t;
+    for (size_t col = 0; col < n; ++col) {
+      size_t pivot = col;
+      while (pivot < n && field_.IsZero(a[pivot * n + col])) pivot++;
+      if (pivot == n) {
+        throw std::runtime_error("ReedSolomon: singular decoding matrix");
+      }
+      if (pivot != col) {
+        for (size_t c = 0; c < n; ++c) {
+          std::swap(a[pivot * n + c], a[col * n + c]);
+          std::swap(inv[pivot * n + c], inv[col * n + c]);
+        }
+      }
+
+      field_.Inv(scale, a[col * n + col]);
+      for (size_t c = 0; c < n; ++c) {
+        field_.Mul(t, a[col * n + c], scale);
+        a[col * n + c] = t;
+        field_.Mul(t, inv[col * n + c], scale);
+        inv[col * n + c] = t;
+      }
+
+      // Characteristic 2: subtracting factor * pivot row is adding it
+      for (size_t r = 0; r < n; ++r) {
+        if (r == col || field_.IsZero(a[r * n + col])) continue;
+        Element factor = a[r * n + col];
+        for (size_t c = 0; c < n; ++c) {
+          field_.MulAdd(a[r * n + c], factor, a[col * n + c]);
+          field_.MulAdd(inv[r * n + c], factor, inv[col * n + c]);
+        }
+      }
+    }
+    return inv;
+  }
+
+  void BuildVandermonde() {
+    const size_t n = k_ + m_;
+    // V[i][j] = i^j over distinct points i = 0, ..., n - 1 (0^0 = 1)
+    std::vector<Element> v(n * k_);
+    Element point;
+    for (size_t i = 0; i < n; ++i) {
+      field_.Init(point, static_cast<uint32_t>(i));
+      field_.Init(v[i * k_], 1);
+      for (size_t j = 1; j < k_; ++j) {
+        field_.Mul(v[i * k_ + j], v[i * k_ + j - 1], point);
+      }
+    }
+
+    std::vector<Element> top(v.begin(), v.begin() + k_ * k_);
+    std::vector<Element> top_inv = Invert(std::move(top), k_);
+
+    // P = bottom m rows of V times the inverse of the top block
+    parity_.assign(m_ * k_, Element());
+    for (size_t r = 0; r < m_; ++r) {
+      for (size_t c = 0; c < k_; ++c) {
+        Element &entry = parity_[r * k_ + c];
+        field_.Init(entry, 0);
+        for (size_t j = 0; j < k_; ++j) {
+          field_.MulAdd(entry, v[(k_ + r) * k_ + j], top_inv[j * k_ + c]);
+        }
+      }
+    }
+  }
+
+  void BuildCauchy() {
+    parity_.assign(m_ * k_, Element());
+    Element x, y, sum;
+    for (size_t r = 0; r < m_; ++r) {
+      field_.Init(x, static_cast<uint32_t>(k_ + r));
+      for (size_t c = 0; c < k_; ++c) {
+        field_.Init(y, static_cast<uint32_t>(c));
+        field_.Add(sum, x, y);
+        field_.Inv(parity_[r * k_ + c], sum);
+      }
+    }
+  }
+
+  const Field &field_;
+  size_t k_;
+  size_t m_;
+  RSMatrix matrix_;
+  std::vector<Element> parity_; // m x k, row-major
+};
+
+} // namespace gfb
@@ -0,0 +1,99 @@
+/**
+ * @file batch_arith.hpp
+ * @brief Batch inversion and division over a pluggable GF(2^m) field
+ *
+ * Montgomery's trick over the same field adapter interface as
+ * gfb::ReedSolomon (see reed_solomon.hpp): n inversions become one
+ * inversion plus 3(n - 1) multiplications. With prefix products
+ * p_i = a_0 ... a_i,
+ *
+ *   a_i^-1 = p_(i-1) * (p_i)^-1,   (p_(i-1))^-1 = a_i * (p_i)^-1,
+ *
+ * so one inversion of p_(n-1) unwinds backwards into every a_i^-1. Division
+ * folds the dividend into the same backward pass, for one more
+ * multiplication per element. The win grows with what a single inversion
+ * costs next to a multiplication: little for log-domain tables, where both
+ * are integer arithmetic, and a large constant factor for polynomial-basis
+ * fields (NTL, CLMUL), where inversion is an extended GCD or an
+ * exponentiation.
+ *
+ * Zero has no inverse. Rather than poisoning the whole batch, zero inputs
+ * (divisors, for division) are skipped in the product chain and produce
+ * zero outputs.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace gfb {
+
+template <typename Field> class BatchArith {
+public:
+  using Element = typename Field::Element;
+
+  // The field must outlive the object
+  explicit BatchArith(const Field &field) : field_(field) { field_.Init(zero_, 0); }
+
+  // out[i] = a[i]^-1, or 0 where a[i] = 0. out may alias a.
+  void Inv(Element *out, const Element *a, size_t n) const {
+    Unwind(out, a, nullptr, n);
+  }
+
+  // out[i] = a[i] / b[i], or 0 where b[i] = 0. out may alias a or b.
+  void Div(Element *out, const Element *a, const Element *b, size_t n) const {
+    Unwind(out, b, a, n);
+  }
+
+private:
+  // out[i] = scale[i] * x[i]^-1, with scale[i] = 1 when scale is null
+  void Unwind(Element *out, const Element *x, const Element *scale, size_t n) const {
+    if (n == 0) return;
+
+    // prefix[i] = product of the nonzero x[0..i]; empty products stay unset
+    // until the first nonzero element
+    std::vector<Element> prefix(n);
+    size_t first = n;
+    for (size_t i = 0; i < n; ++i) {
+      if (field_.IsZero(x[i])) {
+        if (first < i) prefix[i] = prefix[i - 1];
+        continue;
+      }
+      if (first == n) {
+        first = i;
+        prefix[i] = x[i];
+      } else {
+        field_.Mul(prefix[i], prefix[i - 1], x[i]);
+      }
+    }
+    if (first == n) {
+      for (size_t i = 0; i < n; ++i) out[i] = zero_;
+      return;
+    }
+
+    // inv = (prefix[i])^-1 at the top of each step
+    Element inv, xi, r;
+    field_.Inv(inv, prefix[n - 1]);
+    for (size_t i = n; i-- > first + 1;) {
+      if (field_.IsZero(x[i])) {
+        out[i] = zero_;
+        continue;
+      }
+      xi = x[i]; // Before out[i] is written, which may alias x
+      field_.Mul(r, inv, prefix[i - 1]);
+      if (scale) field_.Mul(r, r, scale[i]);
+      out[i] = r;
+      field_.Mul(inv, inv, xi);
+    }
+    // inv is now x[first]^-1
+    if (scale) field_.Mul(inv, inv, scale[first]);
+    out[first] = inv;
+    for (size_t i = 0; i < first; ++i) out[i] = zero_;
+  }
+
+  const Field &field_;
+  Element zero_;
+};
+
+} // namespace gfb
@@ -0,0 +1,203 @@
+/**
+ * @file gf2m_basis_map.hpp
+ * @brief Isomorphism between a GF(2^m) field's own basis and a polynomial basis
+ *
+ * Fields that do not work in a polynomial basis (towers, normal bases) still
+ * need to read and write the shared polynomial-basis operands, so results
+ * compare with the other backends. Both representations are m-bit vectors
+ * over GF(2), which makes the isomorphism an m x m bit matrix.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+/**
+ * @brief Isomorphism between a field's own basis and a polynomial basis
+ *
+ * x maps to a root B of the modulus in Field, and x^i to B^i. The root is
+ * found by trace splitting: for a rotating d,
+ * gcd(f, Tr(d x) mod f) separates the roots of f by the value of Tr(d r),
+ * and repeating on a factor isolates one root in O(m^3) field operations.
+ * Both directions are then applied as byte-indexed lookups, one table of
+ * 256 entries per byte of the m bits.
+ *
+ * @tparam Field A field whose elements are m-bit vectors with XOR addition
+ *         (GF2mTower, GF2mNormal), 2 <= m <= 32.
+ */
+template <typename Field> class GF2mBasisMap {
+public:
+  using Element = typename Field::Element;
+
+  // `poly` is an irreducible modulus of degree field.Degree(), given as a
+  // bitmask including x^m
+  GF2mBasisMap(const Field &field, uint64_t poly)
+      : m_(field.Degree()), bytes_((m_ + 7) / 8) {
+    if (m_ < kMinModulusDegree || m_ > kMaxModulusDegree) {
+      throw std::invalid_argument("GF2mBasisMap: degree " + std::to_string(m_) +
+                                  " out of range");
+    }
+    if (!IsIrreducibleModulus(static_cast<uint8_t>(m_), poly)) {
+      throw std::invalid_argument("GF2mBasisMap: modulus is not irreducible");
+    }
+    BuildTables(field, FindRoot(field, poly));
+  }
+
+  unsigned Degree() const { return m_; }
+  size_t TableBytes() const {
+    return to_field_.size() * sizeof(Element) + to_poly_.size() * sizeof(uint32_t);
+  }
+
+  // Polynomial-basis value -> field element
+  Element ToField(uint32_t value) const {
+    Element r = 0;
+    for (unsigned k = 0; k < bytes_; ++k) {
+      r ^= to_field_[k * 256 + ((value >> (8 * k)) & 0xFF)];
+    }
+    return r;
+  }
+
+  // Field element -> polynomial-basis value
+  uint32_t ToPolynomial(Element a) const {
+    uint32_t r = 0;
+    for (unsigned k = 0; k < bytes_; ++k) {
+      r ^= to_poly_[k * 256 + static_cast<size_t>((a >> (8 * k)) & 0xFF)];
+    }
+    return r;
+  }
+
+private:
+  // Polynomials over Field, lowest coefficient first, no trailing zeros
+  using Poly = std::vector<Element>;
+
+  static void Trim(Poly &a) {
+    while (!a.empty() && a.back() == 0) a.pop_back();
+  }
+
+  // a mod f, f monic
+  static void Reduce(const Field &field, Poly &a, const Poly &f) {
+    const size_t d = f.size() - 1;
+    for (size_t i = a.size(); i-- > d;) {
+      const Element c = a[i];
+      if (c == 0) continue;
+      for (size_t j = 0; j <= d; ++j) {
+        a[i - d + j] ^= field.Mul(c, f[j]);
+      }
+    }
+    a.resize(std::min(a.size(), d));
+    Trim(a);
+  }
+
+  static Poly SquareMod(const Field &field, const Poly &a, const Poly &f) {
+    // Char 2: (sum a_i x^i)^2 = sum a_i^2 x^(2i)
+    Poly r(a.empty() ? 0 : 2 * a.size() - 1, 0);
+    for (size_t i = 0; i < a.size(); ++i) r[2 * i] = field.Mul(a[i], a[i]);
+    Reduce(field, r, f);
+    return r;
+  }
+
+  // Monic gcd
+  static Poly Gcd(const Field &field, Poly a, Poly b) {
+    Trim(a);
+    Trim(b);
+    while (!b.empty()) {
+      const Element scale = field.Inv(b.back());
+      for (auto &c : b) c = field.Mul(c, scale);
+      Reduce(field, a, b);
+      std::swap(a, b);
+    }
+    const Element scale = field.Inv(a.back());
+    for (auto &c : a) c = field.Mul(c, scale);
+    return a;
+  }
+
+  Element FindRoot(const Field &field, uint64_t poly) const {
+    // The modulus has GF(2) coefficients: 0 and the field's one
+    Poly f(m_ + 1, 0);
+    for (unsigned i = 0; i <= m_; ++i) {
+      if ((poly >> i) & 1) f[i] = field.One();
+    }
+
+    // Every root pair r != s differs in Tr(d r) for some basis element d =
+    // 2^j, so cycling through them always splits f eventually
+    unsigned j = 0;
+    while (f.size() > 2) {
+      const Element d = static_cast<Element>(Element{1} << j);
+      j = (j + 1) % m_;
+      // Tr(d x) = sum_{i < m} (d x)^(2^i) mod f
+      Poly power = {0, d};
+      Reduce(field, power, f);
+      Poly trace = power;
+      for (unsigned i = 1; i < m_; ++i) {
+        power = SquareMod(field, power, f);
+        trace.resize(std::max(trace.size(), power.size()), 0);
+        for (size_t k = 0; k < power.size(); ++k) trace[k] ^= power[k];
+      }
+      Trim(trace);
+      if (trace.empty()) continue;
+      Poly g = Gcd(field, f, trace);
+      if (g.size() > 1 && g.size() < f.size()) f = std::move(g);
+    }
+    // f = x + r, monic
+    return f[0];
+  }
+
+  void BuildTables(const Field &field, Element root) {
+    // Column i of the map is root^i
+    std::vector<Element> column(m_);
+    Element power = field.One();
+    for (unsigned i = 0; i < m_; ++i) {
+      column[i] = power;
+      power = field.Mul(power, root);
+    }
+
+    // Inverse columns by Gauss-Jordan on (field value, polynomial value)
+    // pairs: afterwards pair i holds (bit i, its polynomial preimage)
+    std::vector<std::pair<uint64_t, uint32_t>> pairs(m_);
+    for (unsigned i = 0; i < m_; ++i) pairs[i] = {column[i], uint32_t{1} << i};
+    for (unsigned bit = 0; bit < m_; ++bit) {
+      unsigned pivot = bit;
+      while (pivot < m_ && ((pairs[pivot].first >> bit) & 1) == 0) ++pivot;
+      if (pivot == m_) {
+        throw std::logic_error("GF2mBasisMap: powers of the root are dependent");
+      }
+      std::swap(pairs[bit], pairs[pivot]);
+      for (unsigned i = 0; i < m_; ++i) {
+        if (i != bit && ((pairs[i].first >> bit) & 1)) {
+          pairs[i].first ^= pairs[bit].first;
+          pairs[i].second ^= pairs[bit].second;
+        }
+      }
+    }
+
+    to_field_.assign(bytes_ * 256, 0);
+    to_poly_.assign(bytes_ * 256, 0);
+    for (unsigned k = 0; k < bytes_; ++k) {
+      // The top byte only spans the bits below m
+      const unsigned values = 1u << std::min(8u, m_ - 8 * k);
+      for (unsigned v = 1; v < values; ++v) {
+        const unsigned bit = 8 * k + static_cast<unsigned>(__builtin_ctz(v));
+        const unsigned rest = v & (v - 1);
+        to_field_[k * 256 + v] = to_field_[k * 256 + rest] ^ column[bit];
+        to_poly_[k * 256 + v] = to_poly_[k * 256 + rest] ^ pairs[bit].second;
+      }
+    }
+  }
+
+  unsigned m_;
+  unsigned bytes_;
+  std::vector<Element> to_field_;
+  std::vector<uint32_t> to_poly_;
+};
+
+} // namespace gfb
@@ -0,0 +1,486 @@
+/**
+ * @file gf2m_clmul.hpp
+ * @brief Polynomial-basis GF(2^m) with carry-less multiplication
+ *
+ * Table-based fields stop scaling around m = 20 because their tables grow as
+ * 2^m. Here elements are plain bit vectors and a product is one carry-less
+ * multiply (PCLMULQDQ on x86, PMULL on aarch64) followed by reduction, so the
+ * cost depends on the word count rather than the field order.
+ *
+ * Two reductions are provided:
+ *  - sparse: for trinomial/pentanomial moduli whose middle terms are at most
+ *    m/2, the high half is folded back with 64-bit shifts and XORs;
+ *  - Barrett: for any modulus, two extra carry-less multiplies with the
+ *    precomputed quotient mu = floor(x^(2m) / f).
+ *
+ * GF2mClmul covers 2 <= m <= 64 in one machine word; GF2mClmulWide<W> covers
+ * sparse moduli up to 64W bits (e.g. 128, 163 and 233 with W = 2, 3, 4).
+ *
+ * The hardware instruction is used when the compiler targets it (-mpclmul on
+ * x86; enabled by default on Apple arm64), otherwise a 4-bit windowed
+ * software multiply is used.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__PCLMUL__)
+#include <immintrin.h>
+#define GFB_CLMUL_HARDWARE 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_AES)
+#include <arm_neon.h>
+#define GFB_CLMUL_HARDWARE 1
+#endif
+
+namespace gfb {
+
+using uint128_t = unsigned __int128;
+
+//------------------------------------------------------------------------------
+// Carry-less Multiply
+//------------------------------------------------------------------------------
+
+// True when ClMul64 compiles to the hardware instruction
+constexpr bool ClmulIsHardware() {
+#if defined(GFB_CLMUL_HARDWARE)
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Software carry-less 64x64 -> 128 multiply with a 4-bit window
+inline uint128_t ClMul64Portable(uint64_t a, uint64_t b) {
+  uint128_t table[16];
+  table[0] = 0;
+  table[1] = b;
+  for (int i = 2; i < 16; i += 2) {
+    table[i] = table[i / 2] << 1;
+    table[i + 1] = table[i] ^ b;
+  }
+  uint128_t result = 0;
+  for (int shift = 60; shift >= 0; shift -= 4) {
+    result = (result << 4) ^ table[(a >> shift) & 0x0f];
+  }
+  return result;
+}
+
+inline uint128_t ClMul64(uint64_t a, uint64_t b) {
+#if defined(__PCLMUL__)
+  __m128i p = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<int64_t>(a)),
+                                   _mm_cvtsi64_si128(static_cast<int64_t>(b)),
+                                   0x00);
+  uint64_t lo = static_cast<uint64_t>(_mm_cvtsi128_si64(p));
+  uint64_t hi =
+      static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(p, p)));
+  return (static_cast<uint128_t>(hi) << 64) | lo;
+#elif defined(GFB_CLMUL_HARDWARE)
+  return static_cast<uint128_t>(vmull_p64(a, b));
+#else
+  return ClMul64Portable(a, b);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Sparse Irreducible Polynomials
+//------------------------------------------------------------------------------
+
+// Reduces the 128-bit polynomial c modulo x^m + low (m <= 64) bit by bit.
+// Only used for setup and irreducibility testing.
+inline uint64_t PolyRemSlow(uint128_t c, uint8_t m, uint64_t low) {
+  for (int bit = 127; bit >= m; --bit) {
+    if ((c >> bit) & 1) {
+      c ^= static_cast<uint128_t>(1) << bit;
+      c ^= static_cast<uint128_t>(low) << (bit - m);
+    }
+  }
+  return static_cast<uint64_t>(c);
+}
+
+// gcd of two polynomials held in 64-bit words
+inline uint64_t PolyGcd64(uint64_t a, uint64_t b) {
+  while (b != 0) {
+    int db = 63 - __builtin_clzll(b);
+    while (a != 0 && 63 - __builtin_clzll(a) >= db) {
+      a ^= b << (63 - __builtin_clzll(a) - db);
+    }
+    uint64_t t = a;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// Rabin's test for f = x^m + low: x^(2^m) = x mod f, and
+// gcd(x^(2^(m/p)) - x, f) = 1 for every prime p dividing m.
+inline bool IsIrreducibleBinary(uint8_t m, uint64_t low) {
+  if (m < 2 || m > 64 || (low & 1) == 0) {
+    return false;
+  }
+  auto frobenius = [&](int times) {
+    uint64_t x = 2; // the polynomial x
+    for (int i = 0; i < times; ++i) {
+      x = PolyRemSlow(ClMul64Portable(x, x), m, low);
+    }
+    return x;
+  };
+  if (frobenius(m) != 2) {
+    return false;
+  }
+  const uint128_t f = (static_cast<uint128_t>(1) << m) | low;
+  for (int p = 2; p <= m; ++p) {
+    bool prime = true;
+    for (int d = 2; d * d <= p; ++d) {
+      if (p % d == 0) prime = false;
+    }
+    if (!prime || m % p != 0) continue;
+    uint64_t h = frobenius(m / p) ^ 2;
+    if (h == 0) {
+      return false;
+    }
+    // gcd(h, f) = gcd(h, f mod h), and f mod h fits in a word
+    int dh = 63 - __builtin_clzll(h);
+    uint64_t r =
+        PolyRemSlow(f, static_cast<uint8_t>(dh), h ^ (uint64_t{1} << dh));
+    if (PolyGcd64(h, r) != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Minimal-weight irreducible polynomial x^m + low with all middle terms at
+// most m/2, so the sparse two-fold reduction applies: the trinomial with the
+// smallest k, otherwise the lexicographically smallest pentanomial. Returns
+// the low terms (f - x^m).
+inline uint64_t FindSparseIrreducible(uint8_t m) {
+  for (uint8_t k = 1; k <= m / 2; ++k) {
+    uint64_t low = (uint64_t{1} << k) | 1;
+    if (IsIrreducibleBinary(m, low)) {
+      return low;
+    }
+  }
+  for (uint8_t a = 3; a <= m / 2; ++a) {
+    for (uint8_t b = 2; b < a; ++b) {
+      for (uint8_t c = 1; c < b; ++c) {
+        uint64_t low = (uint64_t{1} << a) | (uint64_t{1} << b) |
+                       (uint64_t{1} << c) | 1;
+        if (IsIrreducibleBinary(m, low)) {
+          return low;
+        }
+      }
+    }
+  }
+  throw std::invalid_argument("No sparse irreducible polynomial of degree " +
+                              std::to_string(m));
+}
+
+//------------------------------------------------------------------------------
+// GF2mClmul (single word, m <= 64)
+//------------------------------------------------------------------------------
+
+enum class ClmulReduction { kSparse, kBarrett };
+
+inline const char *ClmulReductionName(ClmulReduction reduction) {
+  return reduction == ClmulReduction::kSparse ? "sparse" : "barrett";
+}
+
+/**
+ * @brief GF(2^m), m <= 64, in polynomial basis with carry-less multiply
+ *
+ * Elements are uint64_t bit vectors (bit i = coefficient of x^i), the same
+ * integer encoding the other backends use for their polynomial inputs.
+ */
+class GF2mClmul {
+public:
+  using Element = uint64_t;
+
+  // f = x^m + low. Sparse reduction is used when f has at most five terms and
+  // its middle terms are at most m/2; otherwise Barrett.
+  GF2mClmul(uint8_t m, uint64_t low) : m_(m), low_(low) {
+    if (m < 2 || m > 64) {
+      throw std::invalid_argument("GF2mClmul: degree must be in [2, 64]");
+    }
+    if ((m < 64 && (low >> m) != 0) || (low & 1) == 0) {
+      throw std::invalid_argument("GF2mClmul: invalid modulus low terms");
+    }
+    mask_ = m == 64 ? ~uint64_t{0} : (uint64_t{1} << m) - 1;
+
+    for (int k = 0; k < m; ++k) {
+      if ((low >> k) & 1) {
+        if (terms_ < kMaxSparseTerms) sparse_shifts_[terms_] = k;
+        terms_++;
+      }
+    }
+    int top_term = 63 - __builtin_clzll(low);
+    bool sparse = terms_ <= kMaxSparseTerms && 2 * top_term <= m;
+    reduction_ = sparse ? ClmulReduction::kSparse : ClmulReduction::kBarrett;
+
+    // mu = floor(x^(2m) / f) = x^m + floor(low * x^m / f); the second form
+    // avoids x^128 for m = 64
+    uint128_t remainder = static_cast<uint128_t>(low) << m;
+    uint128_t f = (static_cast<uint128_t>(1) << m) | low;
+    uint64_t quotient = 0;
+    for (int bit = 2 * m - 1; bit >= m; --bit) {
+      if ((remainder >> bit) & 1) {
+        quotient |= uint64_t{1} << (bit - m);
+        remainder ^= f << (bit - m);
+      }
+    }
+    mu_low_ = quotient;
+  }
+
+  // Same, forcing a reduction strategy (sparse requires a sparse modulus)
+  GF2mClmul(uint8_t m, uint64_t low, ClmulReduction reduction)
+      : GF2mClmul(m, low) {
+    if (reduction == ClmulReduction::kSparse &&
+        reduction_ != ClmulReduction::kSparse) {
+      throw std::invalid_argument("GF2mClmul: modulus is not sparse enough");
+    }
+    reduction_ = reduction;
+  }
+
+  uint8_t Degree() const { return m_; }
+  uint64_t ModulusLow() const { return low_; }
+  ClmulReduction Reduction() const { return reduction_; }
+  // 2^m saturates at 2^64 - 1 for m = 64
+  uint64_t Order() const { return m_ == 64 ? ~uint64_t{0} : uint64_t{1} << m_; }
+
+  Element Zero() const { return 0; }
+  Element One() const { return 1; }
+  bool IsZero(Element a) const { return a == 0; }
+
+  Element Add(Element a, Element b) const { return a ^ b; }
+  Element Sub(Element a, Element b) const { return a ^ b; }
+
+  Element Mul(Element a, Element b) const { return Reduce(ClMul64(a, b)); }
+  Element Sqr(Element a) const { return Reduce(ClMul64(a, a)); }
+
+  // Itoh-Tsujii: a^-1 = (a^(2^(m-1) - 1))^2 with an addition chain on m - 1.
+  // Requires a != 0.
+  Element Inv(Element a) const {
+    int n = m_ - 1;
+    int top = 31 - __builtin_clz(static_cast<unsigned>(n));
+    Element beta = a; // beta = a^(2^k - 1)
+    int k = 1;
+    for (int bit = top - 1; bit >= 0; --bit) {
+      Element t = beta;
+      for (int i = 0; i < k; ++i) t = Sqr(t);
+      beta = Mul(t, beta);
+      k *= 2;
+      if ((n >> bit) & 1) {
+        beta = Mul(Sqr(beta), a);
+        k += 1;
+      }
+    }
+    return Sqr(beta);
+  }
+
+  // Requires b != 0
+  Element Div(Element a, Element b) const { return Mul(a, Inv(b)); }
+
+  Element Reduce(uint128_t c) const {
+    if (reduction_ == ClmulReduction::kSparse) {
+      return ReduceSparse(c);
+    }
+    return ReduceBarrett(c);
+  }
+
+private:
+  static constexpr int kMaxSparseTerms = 4; // pentanomial: 4 non-leading terms
+
+  // Folds h = c / x^m back in one pass. h * x^k spills h >> (m - k) past
+  // x^m for each middle term k; with every k <= m/2 that spill folds without
+  // spilling again, so both folds collapse into g = h + spill, and the whole
+  // reduction stays in 64-bit arithmetic.
+  Element ReduceSparse(uint128_t c) const {
+    uint64_t h = static_cast<uint64_t>(c >> m_);
+    uint64_t g = h;
+    for (int t = 1; t < terms_; ++t) {
+      g ^= h >> (m_ - sparse_shifts_[t]);
+    }
+    uint64_t r = static_cast<uint64_t>(c);
+    for (int t = 0; t < terms_; ++t) {
+      r ^= g << sparse_shifts_[t];
+    }
+    return r & mask_;
+  }
+
+  // Barrett with f = x^m + low and mu = x^m + mu_low:
+  //   q = floor(floor(c / x^m) * mu / x^m),  r = (c + q * f) mod x^m
+  Element ReduceBarrett(uint128_t c) const {
+    uint64_t t1 = static_cast<uint64_t>(c >> m_);
+    uint64_t q = t1 ^ static_cast<uint64_t>(ClMul64(t1, mu_low_) >> m_);
+    uint64_t qf = static_cast<uint64_t>(ClMul64(q, low_));
+    return (static_cast<uint64_t>(c) ^ qf) & mask_;
+  }
+
+  uint8_t m_;
+  uint64_t low_;
+  uint64_t mask_ = 0;
+  uint64_t mu_low_ = 0;
+  int sparse_shifts_[kMaxSparseTerms] = {0, 0, 0, 0};
+  int terms_ = 0;
+  ClmulReduction reduction_ = ClmulReduction::kBarrett;
+};
+
+//------------------------------------------------------------------------------
+// GF2mClmulWide (W words, sparse moduli)
+//------------------------------------------------------------------------------
+
+/**
+ * @brief GF(2^m) for m <= 64W with a sparse modulus x^m + sum x^k, k <= m/2
+ *
+ * Products use W^2 carry-less multiplies (schoolbook); squaring needs only W
+ * since cross terms vanish in characteristic 2.
+ */
+template <size_t W> class GF2mClmulWide {
+public:
+  using Element = std::array<uint64_t, W>;
+
+  GF2mClmulWide(uint16_t m, std::vector<uint16_t> middle_terms)
+      : m_(m), terms_(std::move(middle_terms)) {
+    if (m <= 64 * (W - 1) || m > 64 * W) {
+      throw std::invalid_argument("GF2mClmulWide: degree does not fit W words");
+    }
+    terms_.push_back(0);
+    for (uint16_t k : terms_) {
+      if (2 * k > m) {
+        throw std::invalid_argument("GF2mClmulWide: middle term above m/2");
+      }
+    }
+  }
+
+  uint16_t Degree() const { return m_; }
+  const std::vector<uint16_t> &Terms() const { return terms_; }
+
+  Element Zero() const { return Element{}; }
+  Element One() const {
+    Element one{};
+    one[0] = 1;
+    return one;
+  }
+  bool IsZero(const Element &a) const {
+    uint64_t any = 0;
+    for (uint64_t w : a) any |= w;
+    return any == 0;
+  }
+
+  // Masks a raw word vector down to a field element
+  Element Canonical(Element a) const {
+    if (m_ % 64 != 0) a[m_ / 64] &= (uint64_t{1} << (m_ % 64)) - 1;
+    for (size_t i = m_ / 64 + (m_ % 64 != 0); i < W; ++i) a[i] = 0;
+    return a;
+  }
+
+  Element Add(const Element &a, const Element &b) const {
+    Element r;
+    for (size_t i = 0; i < W; ++i) r[i] = a[i] ^ b[i];
+    return r;
+  }
+
+  Element Mul(const Element &a, const Element &b) const {
+    std::array<uint64_t, 2 * W> c{};
+    for (size_t i = 0; i < W; ++i) {
+      for (size_t j = 0; j < W; ++j) {
+        uint128_t p = ClMul64(a[i], b[j]);
+        c[i + j] ^= static_cast<uint64_t>(p);
+        c[i + j + 1] ^= static_cast<uint64_t>(p >> 64);
+      }
+    }
+    return Reduce(c);
+  }
+
+  Element Sqr(const Element &a) const {
+    std::array<uint64_t, 2 * W> c{};
+    for (size_t i = 0; i < W; ++i) {
+      uint128_t p = ClMul64(a[i], a[i]);
+      c[2 * i] = static_cast<uint64_t>(p);
+      c[2 * i + 1] = static_cast<uint64_t>(p >> 64);
+    }
+    return Reduce(c);
+  }
+
+  // Itoh-Tsujii, as in GF2mClmul::Inv. Requires a != 0.
+  Element Inv(const Element &a) const {
+    int n = m_ - 1;
+    int top = 31 - __builtin_clz(static_cast<unsigned>(n));
+    Element beta = a;
+    int k = 1;
+    for (int bit = top - 1; bit >= 0; --bit) {
+      Element t = beta;
+      for (int i = 0; i < k; ++i) t = Sqr(t);
+      beta = Mul(t, beta);
+      k *= 2;
+      if ((n >> bit) & 1) {
+        beta = Mul(Sqr(beta), a);
+        k += 1;
+      }
+    }
+    return Sqr(beta);
+  }
+
+  Element Div(const Element &a, const Element &b) const {
+    return Mul(a, Inv(b));
+  }
+
+private:
+  // Two folds of c >> m back onto the low m bits (see GF2mClmul::ReduceSparse)
+  Element Reduce(std::array<uint64_t, 2 * W> c) const {
+    for (int fold = 0; fold < 2; ++fold) {
+      std::array<uint64_t, 2 * W> high = ShiftRight(c, m_);
+      MaskLow(c);
+      for (uint16_t k : terms_) {
+        XorShiftedLeft(c, high, k);
+      }
+    }
+    Element r;
+    for (size_t i = 0; i < W; ++i) r[i] = c[i];
+    return r;
+  }
+
+  static std::array<uint64_t, 2 * W>
+  ShiftRight(const std::array<uint64_t, 2 * W> &c, unsigned s) {
+    std::array<uint64_t, 2 * W> r{};
+    unsigned words = s / 64, bits = s % 64;
+    for (size_t i = 0; i + words < 2 * W; ++i) {
+      r[i] = c[i + words] >> bits;
+      if (bits != 0 && i + words + 1 < 2 * W) {
+        r[i] |= c[i + words + 1] << (64 - bits);
+      }
+    }
+    return r;
+  }
+
+  void MaskLow(std::array<uint64_t, 2 * W> &c) const {
+    size_t word = m_ / 64;
+    if (m_ % 64 != 0) {
+      c[word] &= (uint64_t{1} << (m_ % 64)) - 1;
+      word++;
+    }
+    for (size_t i = word; i < 2 * W; ++i) c[i] = 0;
+  }
+
+  static void XorShiftedLeft(std::array<uint64_t, 2 * W> &c,
+                             const std::array<uint64_t, 2 * W> &h, unsigned s) {
+    unsigned words = s / 64, bits = s % 64;
+    for (size_t i = 2 * W; i-- > words;) {
+      uint64_t v = h[i - words] << bits;
+      if (bits != 0 && i - words >= 1) {
+        v |= h[i - words - 1] >> (64 - bits);
+      }
+      c[i] ^= v;
+    }
+  }
+
+  uint16_t m_;
+  std::vector<uint16_t> terms_; // middle terms followed by 0
+};
+
+} // namespace gfb
@@ -0,0 +1,171 @@
+/**
+ * @file gf2m_log.hpp
+ * @brief Header-only GF(2^m) field in polynomial basis with log/antilog tables
+ *
+ * Elements are bit vectors (bit i = coefficient of x^i), so addition is XOR,
+ * and multiplication, division and inversion go through the discrete log to
+ * the primitive element x: a * b = antilog[log a + log b]. Zero has no log
+ * and is handled with selects, as in GF2mZech.
+ *
+ * Two table layouts trade footprint against work:
+ *  - kSeparate: a log table of 2^m entries and an antilog table doubled to
+ *    2 * (2^m - 1) entries, so exponent sums need no reduction;
+ *  - kInterleaved: one array of 2^m {log, antilog} pairs, 2 * 2^m entries
+ *    in all, with exponent sums folded back below 2^m using 2^m = 1 (mod
+ *    2^m - 1). Every lookup lands in the same region, and the footprint is
+ *    two thirds of kSeparate.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+enum class LogLayout { kSeparate, kInterleaved };
+
+/**
+ * @brief GF(2^m) in polynomial basis over log and antilog tables
+ *
+ * @tparam IndexT Table entry and element type: uint16_t for m <= 16,
+ *         uint32_t for m <= 24.
+ * @tparam Layout Table layout (see the file comment).
+ *
+ * Copies share the tables.
+ */
+template <typename IndexT, LogLayout Layout = LogLayout::kSeparate> class GF2mLog {
+public:
+  using Element = IndexT;
+  static constexpr LogLayout kLayout = Layout;
+
+  static constexpr uint8_t kMaxDegree =
+      sizeof(IndexT) * 8 < 24 ? sizeof(IndexT) * 8 : 24;
+
+  // Builds the field for the primitive polynomial `poly`, given as a bitmask
+  // including x^m
+  GF2mLog(uint8_t m, uint32_t poly) : m_(m), poly_(poly) {
+    if (m < 2 || m > kMaxDegree) {
+      throw std::invalid_argument("GF2mLog: degree " + std::to_string(m) +
+                                  " out of range for table entry type");
+    }
+    if (!IsPrimitiveModulus(m, poly)) {
+      throw std::invalid_argument("GF2mLog: modulus is not primitive");
+    }
+    order_ = 1u << m;
+    qm1_ = order_ - 1;
+    BuildTables();
+  }
+
+  uint8_t Degree() const { return m_; }
+  uint32_t Order() const { return order_; }
+  uint32_t Modulus() const { return poly_; }
+
+  size_t TableBytes() const {
+    const size_t entries = Layout == LogLayout::kSeparate
+                               ? size_t{order_} + 2 * size_t{qm1_}
+                               : 2 * size_t{order_};
+    return entries * sizeof(IndexT);
+  }
+
+  Element Zero() const { return 0; }
+  Element One() const { return 1; }
+  bool IsZero(Element a) const { return a == 0; }
+
+  Element Add(Element a, Element b) const { return static_cast<Element>(a ^ b); }
+
+  Element Mul(Element a, Element b) const {
+    uint32_t r = Antilog(Log(a) + Log(b));
+    return static_cast<Element>((a == 0 || b == 0) ? 0 : r);
+  }
+
+  // Requires b != 0
+  Element Div(Element a, Element b) const {
+    uint32_t r = Antilog(Log(a) + qm1_ - Log(b));
+    return static_cast<Element>(a == 0 ? 0 : r);
+  }
+
+  // Requires a != 0
+  Element Inv(Element a) const { return static_cast<Element>(Antilog(qm1_ - Log(a))); }
+
+private:
+  struct Entry {
+    IndexT log;
+    IndexT antilog;
+  };
+
+  // log(a) in [0, 2^m - 1); log(0) reads as 0
+  uint32_t Log(Element a) const {
+    if constexpr (Layout == LogLayout::kSeparate) {
+      return log_[a];
+    } else {
+      return entries_[a].log;
+    }
+  }
+
+  // x^e for e in [0, 2 * (2^m - 1))
+  uint32_t Antilog(uint32_t e) const {
+    if constexpr (Layout == LogLayout::kSeparate) {
+      return antilog_[e];
+    } else {
+      // e = hi * 2^m + lo = hi + lo (mod 2^m - 1), landing in [0, 2^m - 1];
+      // entry 2^m - 1 holds x^0 like entry 0
+      return entries_[(e & qm1_) + (e >> m_)].antilog;
+    }
+  }
+
+  void BuildTables() {
+    if constexpr (Layout == LogLayout::kSeparate) {
+      // log, then antilog over [0, 2 * (2^m - 1))
+      auto storage = std::make_shared<std::vector<IndexT>>(
+          size_t{order_} + 2 * size_t{qm1_}, 0);
+      IndexT *log = storage->data();
+      IndexT *antilog = log + order_;
+      uint32_t x = 1;
+      for (uint32_t k = 0; k < qm1_; ++k) {
+        antilog[k] = antilog[k + qm1_] = static_cast<IndexT>(x);
+        log[x] = static_cast<IndexT>(k);
+        x = NextPower(x);
+      }
+      log_ = log;
+      antilog_ = antilog;
+      owner_ = std::move(storage);
+    } else {
+      auto storage = std::make_shared<std::vector<Entry>>(order_, Entry{0, 0});
+      Entry *entries = storage->data();
+      uint32_t x = 1;
+      for (uint32_t k = 0; k < qm1_; ++k) {
+        entries[k].antilog = static_cast<IndexT>(x);
+        entries[x].log = static_cast<IndexT>(k);
+        x = NextPower(x);
+      }
+      entries[qm1_].antilog = 1;
+      entries_ = entries;
+      owner_ = std::move(storage);
+    }
+  }
+
+  // x * x^k for x^k given as a polynomial
+  uint32_t NextPower(uint32_t x) const {
+    x <<= 1;
+    return (x & order_) ? x ^ poly_ : x;
+  }
+
+  uint8_t m_;
+  uint32_t poly_;
+  uint32_t order_ = 0;
+  uint32_t qm1_ = 0;
+  std::shared_ptr<const void> owner_;
+  const IndexT *log_ = nullptr;     // kSeparate: polynomial -> log
+  const IndexT *antilog_ = nullptr; // kSeparate: exponent -> polynomial
+  const Entry *entries_ = nullptr;  // kInterleaved: {log, antilog} by index
+};
+
+} // namespace gfb
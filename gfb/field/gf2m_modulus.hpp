@@ -0,0 +1,185 @@
+/**
+ * @file gf2m_modulus.hpp
+ * @brief Primitive moduli for GF(2^m), 2 <= m <= 32
+ *
+ * The one source of field polynomials for every backend. Polynomials are
+ * bitmasks with bit i holding the coefficient of x^i, including x^m, so a
+ * degree-32 modulus needs 33 bits and is carried in a uint64_t.
+ *
+ * Primitivity is decided algebraically rather than by walking the period of
+ * x, which is O(2^m) and out of reach near m = 32:
+ *  - f is irreducible iff x^(2^m) = x mod f and gcd(x^(2^(m/p)) - x, f) = 1
+ *    for every prime p dividing m (Rabin);
+ *  - an irreducible f is primitive iff x^((2^m - 1)/q) != 1 mod f for every
+ *    prime q dividing 2^m - 1.
+ * Both cost O(m^3) bit operations; searching every degree m = 2..32 takes
+ * well under a millisecond in total (about 0.5-0.7 ms at -O2).
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __has_include(<givaro/gfq.h>)
+#include <givaro/gfq.h>
+#endif
+
+namespace gfb {
+
+constexpr uint8_t kMinModulusDegree = 2;
+constexpr uint8_t kMaxModulusDegree = 32;
+
+// Degree of a nonzero polynomial
+inline int PolyDegree(uint64_t a) {
+  return 63 - __builtin_clzll(a);
+}
+
+// a * b mod f for a, b of degree < m, where f = poly has degree m <= 63
+inline uint64_t MulModModulus(uint64_t a, uint64_t b, uint8_t m,
+                              uint64_t poly) {
+  const uint64_t top = uint64_t{1} << m;
+  uint64_t r = 0;
+  while (b != 0) {
+    if (b & 1) r ^= a;
+    b >>= 1;
+    a <<= 1;
+    if (a & top) a ^= poly;
+  }
+  return r;
+}
+
+// x^e mod f
+inline uint64_t PowXModModulus(uint64_t e, uint8_t m, uint64_t poly) {
+  uint64_t result = 1;
+  uint64_t base = 2; // x, already reduced for m >= 2
+  while (e != 0) {
+    if (e & 1) result = MulModModulus(result, base, m, poly);
+    base = MulModModulus(base, base, m, poly);
+    e >>= 1;
+  }
+  return result;
+}
+
+inline uint64_t PolyGcd(uint64_t a, uint64_t b) {
+  while (b != 0) {
+    int db = PolyDegree(b);
+    while (a != 0 && PolyDegree(a) >= db) {
+      a ^= b << (PolyDegree(a) - db);
+    }
+    uint64_t t = a;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// Distinct prime factors by trial division; fine for n < 2^33
+inline std::vector<uint64_t> DistinctPrimeFactors(uint64_t n) {
+  std::vector<uint64_t> factors;
+  for (uint64_t p = 2; p * p <= n; p += (p == 2 ? 1 : 2)) {
+    if (n % p == 0) {
+      factors.push_back(p);
+      while (n % p == 0) n /= p;
+    }
+  }
+  if (n > 1) factors.push_back(n);
+  return factors;
+}
+
+inline bool IsIrreducibleModulus(uint8_t m, uint64_t poly) {
+  if (m < kMinModulusDegree || m > kMaxModulusDegree || poly == 0 ||
+      PolyDegree(poly) != m || (poly & 1) == 0) {
+    return false;
+  }
+  // x^(2^k) mod f by k squarings of x
+  auto frobenius_x = [m, poly](unsigned k) {
+    uint64_t x = 2;
+    for (unsigned i = 0; i < k; ++i) x = MulModModulus(x, x, m, poly);
+    return x;
+  };
+  if (frobenius_x(m) != 2) return false;
+  for (uint64_t p : DistinctPrimeFactors(m)) {
+    if (PolyGcd(poly, frobenius_x(static_cast<unsigned>(m / p)) ^ 2) != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// True when x generates the full multiplicative group of GF(2)[x] / (poly)
+inline bool IsPrimitiveModulus(uint8_t m, uint64_t poly) {
+  if (!IsIrreducibleModulus(m, poly)) return false;
+  const uint64_t group_order = (uint64_t{1} << m) - 1;
+  for (uint64_t q : DistinctPrimeFactors(group_order)) {
+    if (PowXModModulus(group_order / q, m, poly) == 1) return false;
+  }
+  return true;
+}
+
+// Minimal-weight primitive modulus of degree m: the primitive trinomial
+// x^m + x^k + 1 with the smallest k, otherwise the first primitive
+// pentanomial x^m + x^a + x^b + x^c + 1 in (a, b, c) order. Every degree in
+// [2, 32] has one or the other.
+inline uint64_t FindPrimitiveModulus(uint8_t m) {
+  if (m < kMinModulusDegree || m > kMaxModulusDegree) {
+    throw std::invalid_argument("FindPrimitiveModulus: degree " +
+                                std::to_string(m) + " out of range");
+  }
+  const uint64_t ends = (uint64_t{1} << m) | 1;
+  for (uint8_t k = 1; k < m; ++k) {
+    uint64_t poly = ends | (uint64_t{1} << k);
+    if (IsPrimitiveModulus(m, poly)) return poly;
+  }
+  for (uint8_t a = 3; a < m; ++a) {
+    for (uint8_t b = 2; b < a; ++b) {
+      for (uint8_t c = 1; c < b; ++c) {
+        uint64_t poly =
+            ends | (uint64_t{1} << a) | (uint64_t{1} << b) | (uint64_t{1} << c);
+        if (IsPrimitiveModulus(m, poly)) return poly;
+      }
+    }
+  }
+  throw std::invalid_argument(
+      "No primitive trinomial or pentanomial of degree " + std::to_string(m));
+}
+
+// Exponents of the nonzero terms, highest first (e.g. {8, 4, 3, 2, 0})
+inline std::vector<int> ModulusTerms(uint64_t poly) {
+  std::vector<int> terms;
+  for (int i = 63; i >= 0; --i) {
+    if ((poly >> i) & 1) terms.push_back(i);
+  }
+  return terms;
+}
+
+// Coefficients from x^0 to x^m, 0 or 1 (Givaro's modulus form)
+template <typename Coefficient = int>
+inline std::vector<Coefficient> ModulusCoefficients(uint64_t poly) {
+  const int m = 63 - __builtin_clzll(poly);
+  std::vector<Coefficient> coefficients(m + 1);
+  for (int i = 0; i <= m; ++i) coefficients[i] = (poly >> i) & 1;
+  return coefficients;
+}
+
+// "x^8 + x^4 + x^3 + x^2 + 1"
+inline std::string ModulusToString(uint64_t poly) {
+  std::string text;
+  for (int i : ModulusTerms(poly)) {
+    if (!text.empty()) text += " + ";
+    text += i == 0 ? "1" : i == 1 ? "x" : "x^" + std::to_string(i);
+  }
+  return text;
+}
+
+#if __has_include(<givaro/gfq.h>)
+// Givaro's GF(2^m) over the shared modulus rather than Givaro's default, so
+// it is the same field as the in-tree engines built from FindPrimitiveModulus
+inline Givaro::GFq<uint64_t> MakeGivaroField(uint8_t m) {
+  return Givaro::GFq<uint64_t>(2, m, ModulusCoefficients<uint64_t>(FindPrimitiveModulus(m)));
+}
+#endif
+
+} // namespace gfb
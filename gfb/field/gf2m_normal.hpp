@@ -0,0 +1,236 @@
+/**
+ * @file gf2m_normal.hpp
+ * @brief Header-only GF(2^m) in a Gaussian normal basis
+ *
+ * A normal basis {B, B^2, B^4, ..., B^(2^(m-1))} writes a = sum a_i B^(2^i),
+ * and since squaring is linear in characteristic 2 it only moves each
+ * coefficient up one place: a^2 is a rotated left by one bit, and sqrt(a)
+ * rotated right. Both are a couple of instructions, where polynomial-basis
+ * fields pay a reduction (CLMUL) or a full table multiplication.
+ *
+ * Multiplication is the Massey-Omura form for a Gaussian normal basis (GNB)
+ * of type T, following IEEE 1363-2000 A.3.7. With p = Tm + 1 prime and u of
+ * order T mod p, every n in [1, p) is 2^i u^j for a unique i in [0, m), and
+ * F(n) = i. Then, with rot(x, s) placing x_(k+s) at bit k,
+ *
+ *   a * b = sum_(t = 2..p-1) rot(a, F(t)) & rot(b, F(1 - t)),
+ *
+ * plus, for odd T, the parity of a & rot(b, m/2) in every bit. Grouping the
+ * terms by F(t) leaves m ANDs and about Tm XORs of precomputed rotations of
+ * b, so low types are fast: T = 1 and 2 are optimal normal bases.
+ *
+ * The same rotation makes the trace the parity of the bits (times One), and
+ * z^2 + z = c a chain z_i = z_(i-1) + c_i solved by a prefix XOR.
+ *
+ * A GNB exists for every m not divisible by 8; the smallest type is used.
+ * GF2mBasisMap (gf2m_basis_map.hpp) converts to and from polynomial basis.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+class GF2mNormal {
+public:
+  using Element = uint64_t;
+
+  // Largest type tried; every degree up to 64 not divisible by 8 has a GNB
+  // of type at most 32
+  static constexpr unsigned kMaxType = 32;
+
+  explicit GF2mNormal(uint8_t m)
+      : m_(m), mask_(m == 64 ? ~uint64_t{0} : (uint64_t{1} << m) - 1) {
+    if (m < 2 || m > 64) {
+      throw std::invalid_argument("GF2mNormal: degree must be in [2, 64]");
+    }
+    if (m % 8 == 0) {
+      throw std::invalid_argument("GF2mNormal: no Gaussian normal basis for degree " +
+                                  std::to_string(m));
+    }
+    for (type_ = 1; type_ <= kMaxType; ++type_) {
+      if (HasGaussianBasis(m, type_)) break;
+    }
+    if (type_ > kMaxType) {
+      throw std::invalid_argument("GF2mNormal: no Gaussian normal basis of type at most " +
+                                  std::to_string(kMaxType) + " for degree " +
+                                  std::to_string(m));
+    }
+    BuildTerms();
+  }
+
+  uint8_t Degree() const { return m_; }
+  // 2^m saturates at 2^64 - 1 for m = 64
+  uint64_t Order() const { return m_ == 64 ? ~uint64_t{0} : uint64_t{1} << m_; }
+  // T in p = Tm + 1
+  unsigned Type() const { return type_; }
+
+  Element Zero() const { return 0; }
+  // B + B^2 + ... + B^(2^(m-1)) = Tr(B) = 1
+  Element One() const { return mask_; }
+  bool IsZero(Element a) const { return a == 0; }
+
+  Element Add(Element a, Element b) const { return a ^ b; }
+
+  Element Mul(Element a, Element b) const {
+    Element rotated_b[64];
+    for (unsigned s = 0; s < m_; ++s) rotated_b[s] = Rotate(b, s);
+
+    Element c = 0;
+    for (unsigned i = 0; i < m_; ++i) {
+      Element sum = 0;
+      for (unsigned k = starts_[i]; k < starts_[i + 1]; ++k) {
+        sum ^= rotated_b[partners_[k]];
+      }
+      c ^= Rotate(a, i) & sum;
+    }
+    if (type_ % 2 == 1 && (__builtin_popcountll(a & Rotate(b, m_ / 2)) & 1)) {
+      c ^= mask_;
+    }
+    return c;
+  }
+
+  // a^2: bit i -> bit i + 1
+  Element Square(Element a) const { return Rotate(a, m_ - 1); }
+
+  // a^(1/2) = a^(2^(m-1)): bit i -> bit i - 1
+  Element Sqrt(Element a) const { return Rotate(a, 1); }
+
+  // Tr(a) = a + a^2 + ... + a^(2^(m-1)) sums every rotation, so each bit
+  // holds the parity of a: Zero or One
+  Element Trace(Element a) const {
+    return (__builtin_popcountll(a) & 1) ? mask_ : 0;
+  }
+
+  // z with z^2 + z = c, bit i of c being z_(i-1) + z_i: with z_0 = 0, z_i =
+  // c_1 + ... + c_i. False, with z unspecified, when Tr(c) = 1. The other
+  // solution is z + One.
+  bool SolveQuadratic(Element c, Element &z) const {
+    Element x = c & ~Element{1};
+    for (unsigned s = 1; s < m_; s *= 2) x ^= x << s;
+    z = x & mask_;
+    return (__builtin_popcountll(c) & 1) == 0;
+  }
+
+  // Itoh-Tsujii: a^-1 = (a^(2^(m-1) - 1))^2 with an addition chain on m - 1,
+  // each run of k squarings being one rotation. Requires a != 0.
+  Element Inv(Element a) const {
+    const unsigned n = m_ - 1u;
+    const int top = 31 - __builtin_clz(n);
+    Element beta = a; // beta = a^(2^k - 1)
+    unsigned k = 1;
+    for (int bit = top - 1; bit >= 0; --bit) {
+      beta = Mul(Rotate(beta, m_ - k), beta);
+      k *= 2;
+      if ((n >> bit) & 1) {
+        beta = Mul(Square(beta), a);
+        k += 1;
+      }
+    }
+    return Square(beta);
+  }
+
+  // Requires b != 0
+  Element Div(Element a, Element b) const { return Mul(a, Inv(b)); }
+
+private:
+  // Bit k of the result is bit (k + s) mod m of x, for s in [0, m)
+  Element Rotate(Element x, unsigned s) const {
+    return s == 0 ? x : ((x >> s) | (x << (m_ - s))) & mask_;
+  }
+
+  static uint64_t PowMod(uint64_t base, uint64_t e, uint64_t p) {
+    uint64_t r = 1;
+    base %= p;
+    for (; e; e >>= 1) {
+      if (e & 1) r = r * base % p;
+      base = base * base % p;
+    }
+    return r;
+  }
+
+  static bool IsPrime(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t d = 2; d * d <= n; ++d) {
+      if (n % d == 0) return false;
+    }
+    return true;
+  }
+
+  static uint64_t Gcd(uint64_t a, uint64_t b) {
+    while (b) {
+      const uint64_t t = a % b;
+      a = b;
+      b = t;
+    }
+    return a;
+  }
+
+  // Multiplicative order of 2 mod p, p an odd prime
+  static uint64_t OrderOfTwo(uint64_t p) {
+    uint64_t order = p - 1;
+    for (uint64_t q : DistinctPrimeFactors(p - 1)) {
+      while (order % q == 0 && PowMod(2, order / q, p) == 1) order /= q;
+    }
+    return order;
+  }
+
+  // IEEE 1363-2000 A.3.6: a type T GNB exists iff p = Tm + 1 is prime and
+  // gcd(Tm / k, m) = 1, k the order of 2 mod p
+  static bool HasGaussianBasis(unsigned m, unsigned type) {
+    const uint64_t p = uint64_t{type} * m + 1;
+    if (!IsPrime(p)) return false;
+    return Gcd(uint64_t{type} * m / OrderOfTwo(p), m) == 1;
+  }
+
+  // Groups the product terms by F(t): partners_[starts_[i] .. starts_[i + 1])
+  // lists F(1 - t) for every t in [2, p) with F(t) = i
+  void BuildTerms() {
+    const uint64_t p = uint64_t{type_} * m_ + 1;
+
+    // u = g^m has order T for a primitive root g
+    uint64_t g = 2;
+    const auto factors = DistinctPrimeFactors(p - 1);
+    for (;; ++g) {
+      bool primitive = true;
+      for (uint64_t q : factors) primitive = primitive && PowMod(g, (p - 1) / q, p) != 1;
+      if (primitive) break;
+    }
+    const uint64_t u = PowMod(g, m_, p);
+
+    std::vector<unsigned> f(p, 0);
+    uint64_t w = 1;
+    for (unsigned j = 0; j < type_; ++j) {
+      uint64_t n = w;
+      for (unsigned i = 0; i < m_; ++i) {
+        f[n] = i;
+        n = 2 * n % p;
+      }
+      w = w * u % p;
+    }
+
+    starts_.assign(m_ + 1, 0);
+    for (uint64_t t = 2; t < p; ++t) ++starts_[f[t] + 1];
+    for (unsigned i = 0; i < m_; ++i) starts_[i + 1] += starts_[i];
+    partners_.assign(starts_[m_], 0);
+    std::vector<unsigned> next(starts_.begin(), starts_.end() - 1);
+    for (uint64_t t = 2; t < p; ++t) {
+      partners_[next[f[t]]++] = static_cast<uint8_t>(f[(p + 1 - t) % p]);
+    }
+  }
+
+  uint8_t m_;
+  Element mask_;
+  unsigned type_ = 0;
+  std::vector<unsigned> starts_;
+  std::vector<uint8_t> partners_;
+};
+
+} // namespace gfb
@@ -0,0 +1,183 @@
+/**
+ * @file gf2m_pow.hpp
+ * @brief Exponentiation in GF(2^m) for polynomial-basis fields
+ *
+ * Three strategies over any field with a value-returning Mul(a, b):
+ *  - PowSquareMultiply: left-to-right binary, the baseline every library
+ *    ships (m squarings plus about m / 2 multiplications);
+ *  - PowSlidingWindow: the same squarings, but only one multiplication per
+ *    window of up to `window` bits, from a table of odd powers;
+ *  - GF2mFrobeniusPow: squaring is linear over GF(2) in polynomial basis, so
+ *    w consecutive squarings, a -> a^(2^w), are one precomputed linear map.
+ *    It is applied as a byte-sliced table (ceil(m / 8) lookups and XORs) in
+ *    place of w dependent multiplier passes, leaving one multiplication per
+ *    w-bit digit of the exponent.
+ * Table (log-domain) fields do not need any of this: a^e is one modular
+ * multiplication of the logarithm, see GF2mZech::Pow.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace gfb {
+
+// Bit length of e, 0 for e = 0
+inline unsigned ExponentBits(uint64_t e) {
+  return e == 0 ? 0 : 64 - static_cast<unsigned>(__builtin_clzll(e));
+}
+
+template <typename Field, typename Element>
+Element PowSquareMultiply(const Field &field, Element a, uint64_t e,
+                          Element one) {
+  Element r = one;
+  for (int i = static_cast<int>(ExponentBits(e)) - 1; i >= 0; --i) {
+    r = field.Mul(r, r);
+    if ((e >> i) & 1) {
+      r = field.Mul(r, a);
+    }
+  }
+  return r;
+}
+
+// Left-to-right sliding window over odd powers a, a^3, ..., a^(2^w - 1);
+// window must be in [1, 8]
+template <typename Field, typename Element>
+Element PowSlidingWindow(const Field &field, Element a, uint64_t e, Element one,
+                         unsigned window = 4) {
+  if (window < 1 || window > 8) {
+    throw std::invalid_argument("PowSlidingWindow: window must be 1..8");
+  }
+  if (e == 0) return one;
+
+  std::array<Element, 128> odd; // odd[k] = a^(2k + 1)
+  const size_t odd_count = size_t{1} << (window - 1);
+  Element a2 = field.Mul(a, a);
+  odd[0] = a;
+  for (size_t k = 1; k < odd_count; ++k) {
+    odd[k] = field.Mul(odd[k - 1], a2);
+  }
+
+  Element r = one;
+  bool started = false;
+  int i = static_cast<int>(ExponentBits(e)) - 1;
+  while (i >= 0) {
+    if (((e >> i) & 1) == 0) {
+      r = field.Mul(r, r);
+      i--;
+      continue;
+    }
+    // Longest window ending in a set bit: bits i down to low
+    int low = std::max(i - static_cast<int>(window) + 1, 0);
+    while (((e >> low) & 1) == 0) low++;
+    const unsigned width = static_cast<unsigned>(i - low + 1);
+    const uint64_t digit = (e >> low) & ((uint64_t{1} << width) - 1);
+    if (started) {
+      for (unsigned s = 0; s < width; ++s) r = field.Mul(r, r);
+      r = field.Mul(r, odd[digit >> 1]);
+    } else {
+      r = odd[digit >> 1]; // Squaring one is a no-op
+      started = true;
+    }
+    i = low - 1;
+  }
+  return r;
+}
+
+/**
+ * @brief Fixed-window exponentiation with a tabulated a -> a^(2^w) map
+ *
+ * For fields whose elements are uint64_t polynomial-basis bit vectors of
+ * degree < m <= 64 (e.g. GF2mClmul). The table holds ceil(m / 8) * 256
+ * words (16 KiB at m = 64) and is built once per field and window.
+ * The field must outlive the engine.
+ */
+template <typename Field> class GF2mFrobeniusPow {
+public:
+  using Element = uint64_t;
+
+  GF2mFrobeniusPow(const Field &field, unsigned window = 4)
+      : field_(field), m_(field.Degree()), window_(window) {
+    if (window < 1 || window > 8) {
+      throw std::invalid_argument("GF2mFrobeniusPow: window must be 1..8");
+    }
+    if (m_ < 1 || m_ > 64) {
+      throw std::invalid_argument("GF2mFrobeniusPow: degree must be 1..64");
+    }
+    bytes_ = (m_ + 7) / 8;
+    order_minus_one_ = m_ == 64 ? ~uint64_t{0} : (uint64_t{1} << m_) - 1;
+
+    // Image of each basis vector x^i under w squarings
+    std::vector<Element> basis(m_);
+    for (unsigned i = 0; i < m_; ++i) {
+      Element b = Element{1} << i;
+      for (unsigned s = 0; s < window_; ++s) b = field_.Mul(b, b);
+      basis[i] = b;
+    }
+    table_.assign(bytes_ * 256, 0);
+    for (unsigned j = 0; j < bytes_; ++j) {
+      for (unsigned byte = 1; byte < 256; ++byte) {
+        Element image = 0;
+        for (unsigned bit = 0; bit < 8; ++bit) {
+          unsigned i = 8 * j + bit;
+          if (((byte >> bit) & 1) && i < m_) image ^= basis[i];
+        }
+        table_[j * 256 + byte] = image;
+      }
+    }
+  }
+
+  unsigned Window() const { return window_; }
+  size_t TableBytes() const { return table_.size() * sizeof(Element); }
+
+  // a^(2^w)
+  Element Frobenius(Element a) const {
+    Element r = 0;
+    for (unsigned j = 0; j < bytes_; ++j) {
+      r ^= table_[j * 256 + ((a >> (8 * j)) & 0xff)];
+    }
+    return r;
+  }
+
+  Element Pow(Element a, uint64_t e) const {
+    if (a == 0) return e == 0 ? 1 : 0;
+    // Nonzero elements have order dividing 2^m - 1
+    e %= order_minus_one_;
+    if (e == 0) return 1;
+
+    std::array<Element, 256> powers; // powers[d] = a^d
+    const size_t digits = size_t{1} << window_;
+    powers[0] = 1;
+    powers[1] = a;
+    for (size_t d = 2; d < digits; ++d) {
+      powers[d] = field_.Mul(powers[d - 1], a);
+    }
+
+    const unsigned bits = ExponentBits(e);
+    int shift = static_cast<int>((bits - 1) / window_ * window_);
+    const uint64_t mask = digits - 1;
+    Element r = powers[(e >> shift) & mask];
+    for (shift -= static_cast<int>(window_); shift >= 0;
+         shift -= static_cast<int>(window_)) {
+      r = Frobenius(r);
+      uint64_t digit = (e >> shift) & mask;
+      if (digit != 0) r = field_.Mul(r, powers[digit]);
+    }
+    return r;
+  }
+
+private:
+  const Field &field_;
+  unsigned m_;
+  unsigned window_;
+  unsigned bytes_ = 0;
+  uint64_t order_minus_one_ = 0;
+  std::vector<Element> table_; // bytes_ tables of 256 images
+};
+
+} // namespace gfb
@@ -0,0 +1,180 @@
+/**
+ * @file gf2m_table_cache.hpp
+ * @brief On-disk, memory-mapped table cache for GF2mZech
+ *
+ * Building the log, antilog and Zech tables costs O(2^m) work and writes
+ * 3 * 2^m entries, which dominates process start for m = 16..24. This file
+ * stores the tables once in a flat binary file and maps it read-only, so a
+ * later start costs an mmap plus page-ins, and every process mapping the
+ * same file shares one physical copy through the page cache.
+ *
+ * Layout: a ZechTableHeader, zero padding up to kZechTableAlignment, then
+ * the log, antilog and Zech tables of 2^m native-endian IndexT entries each,
+ * exactly as GF2mZech builds them. Files are written to a temporary name and
+ * renamed into place, so concurrent writers never expose a partial file.
+ * POSIX only (open/mmap).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gf2m_zech.hpp"
+
+namespace gfb {
+
+constexpr char kZechTableMagic[8] = {'G', 'F', 'B', 'Z', 'E', 'C', 'H', '1'};
+constexpr uint32_t kZechTableByteOrder = 0x01020304;
+constexpr uint32_t kZechTableVersion = 1;
+// Tables start on a page boundary, so they map page-aligned
+constexpr size_t kZechTableAlignment = 4096;
+
+struct ZechTableHeader {
+  char magic[8];
+  uint32_t byte_order;  // kZechTableByteOrder as written by the producer
+  uint32_t version;
+  uint32_t entry_bytes; // sizeof(IndexT)
+  uint32_t degree;
+  uint32_t modulus;
+  uint32_t order;
+  uint64_t table_offset; // From the start of the file to the log table
+};
+
+// Canonical cache file name for a table set
+inline std::string ZechTableFileName(uint8_t m, uint32_t poly,
+                                     size_t entry_bytes) {
+  char name[64];
+  std::snprintf(name, sizeof(name), "gf2m_zech_m%u_p%x_u%zu.tbl",
+                static_cast<unsigned>(m), poly, entry_bytes * 8);
+  return name;
+}
+
+// Writes the tables of `field` to `path`, replacing any existing file
+// atomically. Throws std::runtime_error on I/O failure.
+template <typename IndexT>
+void SaveZechTables(const GF2mZech<IndexT> &field, const std::string &path) {
+  ZechTableHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kZechTableMagic, sizeof(header.magic));
+  header.byte_order = kZechTableByteOrder;
+  header.version = kZechTableVersion;
+  header.entry_bytes = sizeof(IndexT);
+  header.degree = field.Degree();
+  header.modulus = field.Modulus();
+  header.order = field.Order();
+  header.table_offset = kZechTableAlignment;
+
+  const std::string temporary = path + ".tmp." + std::to_string(getpid());
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    const std::string padding(kZechTableAlignment - sizeof(header), '\0');
+    const std::streamsize table_bytes =
+        static_cast<std::streamsize>(field.Order() * sizeof(IndexT));
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    out.write(reinterpret_cast<const char *>(field.LogTable()), table_bytes);
+    out.write(reinterpret_cast<const char *>(field.AntilogTable()), table_bytes);
+    out.write(reinterpret_cast<const char *>(field.ZechTable()), table_bytes);
+    if (!out) {
+      std::remove(temporary.c_str());
+      throw std::runtime_error("SaveZechTables: cannot write " + temporary);
+    }
+  }
+  if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+    std::remove(temporary.c_str());
+    throw std::runtime_error("SaveZechTables: cannot rename to " + path);
+  }
+}
+
+// Maps a table file read-only and returns a field that uses the mapping
+// directly; the mapping lives as long as any copy of the field. Throws
+// std::runtime_error when the file is missing, truncated or was written for
+// another entry type, byte order or format version.
+template <typename IndexT>
+GF2mZech<IndexT> MapZechTables(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("MapZechTables: cannot open " + path);
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(ZechTableHeader)) {
+    close(fd);
+    throw std::runtime_error("MapZechTables: truncated header in " + path);
+  }
+  const size_t size = static_cast<size_t>(info.st_size);
+  void *base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); // The mapping keeps the file referenced
+  if (base == MAP_FAILED) {
+    throw std::runtime_error("MapZechTables: cannot map " + path);
+  }
+  std::shared_ptr<const void> owner(
+      base, [size](const void *p) { munmap(const_cast<void *>(p), size); });
+
+  ZechTableHeader header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(header.magic, kZechTableMagic, sizeof(header.magic)) != 0 ||
+      header.byte_order != kZechTableByteOrder ||
+      header.version != kZechTableVersion ||
+      header.entry_bytes != sizeof(IndexT) || header.degree >= 32 ||
+      header.order != (1u << header.degree)) {
+    throw std::runtime_error("MapZechTables: incompatible table file " + path);
+  }
+  const size_t table_bytes = size_t{header.order} * sizeof(IndexT);
+  if (header.table_offset % alignof(IndexT) != 0 ||
+      header.table_offset + 3 * table_bytes > size) {
+    throw std::runtime_error("MapZechTables: truncated tables in " + path);
+  }
+
+  const auto *log = reinterpret_cast<const IndexT *>(
+      static_cast<const char *>(base) + header.table_offset);
+  return GF2mZech<IndexT>(static_cast<uint8_t>(header.degree), header.modulus,
+                          log, log + header.order, log + 2 * size_t{header.order},
+                          std::move(owner));
+}
+
+// Returns the field for (m, poly) mapped from the cache in `directory`,
+// generating and saving the tables first when no usable file exists. If the
+// directory cannot be written, the freshly built heap field is returned.
+template <typename IndexT>
+GF2mZech<IndexT> OpenCachedGF2mZech(const std::string &directory, uint8_t m,
+                                    uint32_t poly) {
+  const std::string path =
+      (std::filesystem::path(directory) /
+       ZechTableFileName(m, poly, sizeof(IndexT)))
+          .string();
+  try {
+    GF2mZech<IndexT> mapped = MapZechTables<IndexT>(path);
+    if (mapped.Degree() == m && mapped.Modulus() == poly) {
+      return mapped;
+    }
+  } catch (const std::runtime_error &) {
+    // Missing or stale: rebuild below
+  }
+
+  GF2mZech<IndexT> built(m, poly);
+  try {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    SaveZechTables(built, path);
+    return MapZechTables<IndexT>(path);
+  } catch (const std::runtime_error &) {
+    return built;
+  }
+}
+
+} // namespace gfb
@@ -0,0 +1,152 @@
+/**
+ * @file gf2m_tower.hpp
+ * @brief Header-only composite (tower) fields GF((2^8)^2) and GF(((2^8)^2)^2)
+ *
+ * A degree-2 extension of a base field K = GF(2^k) is K[y] / (y^2 + y + L),
+ * with L chosen so the quadratic is irreducible (absolute trace Tr(L) = 1).
+ * An element a1 * y + a0 is packed as (a1 << k) | a0, and
+ *
+ *   (a1 y + a0)(b1 y + b0) = ((a0 + a1)(b0 + b1) + a0 b0) y + (a0 b0 + L a1 b1)
+ *
+ * costs three base multiplications plus one by L (Karatsuba). Inversion goes
+ * through the norm: (a1 y + a0)^-1 = (a1 y + a0 + a1) / (a0 (a0 + a1) + L a1^2),
+ * one base inversion and a few base multiplications.
+ *
+ * Stacking two levels over GF(2^8) in log/antilog form gives GF(2^16) and
+ * GF(2^32) whose only tables are the 766 bytes of the GF(2^8) base, L1
+ * resident at any degree, where direct log/Zech tables need 2^m entries
+ * each. The price is 4 (GF(2^16)) or 16 (GF(2^32)) GF(2^8) multiplications
+ * per product, counting the one by L, instead of one lookup chain.
+ *
+ * The tower basis is not the polynomial basis of any modulus; GF2mBasisMap
+ * (gf2m_basis_map.hpp) converts to and from the polynomial basis of a given
+ * irreducible modulus, so operands and results can be compared with the
+ * other backends.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "gf2m_log.hpp"
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+/**
+ * @brief Degree-2 extension K[y] / (y^2 + y + L) of a binary field K
+ *
+ * @tparam Base The field K: GF2mLog<uint8_t> or another GF2mTower. Its
+ *         elements must be bit vectors of Base::Degree() bits with XOR as
+ *         addition.
+ *
+ * Copies share the base tables.
+ */
+template <typename Base> class GF2mTower {
+public:
+  using BaseField = Base;
+  using BaseElement = typename Base::Element;
+  using Element = std::conditional_t<
+      sizeof(BaseElement) == 1, uint16_t,
+      std::conditional_t<sizeof(BaseElement) == 2, uint32_t, uint64_t>>;
+
+  explicit GF2mTower(Base base)
+      : base_(std::move(base)), k_(base_.Degree()), low_mask_((Element{1} << k_) - 1) {
+    if (k_ != sizeof(BaseElement) * 8) {
+      throw std::invalid_argument("GF2mTower: base degree " + std::to_string(k_) +
+                                  " does not fill its element type");
+    }
+    lambda_ = FindLambda();
+  }
+
+  uint8_t Degree() const { return static_cast<uint8_t>(2 * k_); }
+  uint64_t Order() const { return uint64_t{1} << Degree(); }
+  // L in y^2 + y + L
+  BaseElement Lambda() const { return lambda_; }
+  size_t TableBytes() const { return base_.TableBytes(); }
+
+  Element Zero() const { return 0; }
+  Element One() const { return 1; }
+  bool IsZero(Element a) const { return a == 0; }
+
+  Element Add(Element a, Element b) const { return static_cast<Element>(a ^ b); }
+
+  Element Mul(Element a, Element b) const {
+    const BaseElement a0 = Low(a), a1 = High(a), b0 = Low(b), b1 = High(b);
+    const BaseElement lo = base_.Mul(a0, b0);
+    const BaseElement hi = base_.Mul(a1, b1);
+    const BaseElement mid = base_.Mul(Sum(a0, a1), Sum(b0, b1));
+    return Pack(Sum(mid, lo), Sum(lo, base_.Mul(lambda_, hi)));
+  }
+
+  Element Square(Element a) const {
+    const BaseElement a0 = Low(a), a1 = High(a);
+    const BaseElement hi = base_.Mul(a1, a1);
+    return Pack(hi, Sum(base_.Mul(a0, a0), base_.Mul(lambda_, hi)));
+  }
+
+  // Requires a != 0
+  Element Inv(Element a) const {
+    const BaseElement a0 = Low(a), a1 = High(a);
+    const BaseElement conjugate0 = Sum(a0, a1);
+    const BaseElement norm =
+        Sum(base_.Mul(a0, conjugate0), base_.Mul(lambda_, base_.Mul(a1, a1)));
+    const BaseElement scale = base_.Inv(norm);
+    return Pack(base_.Mul(a1, scale), base_.Mul(conjugate0, scale));
+  }
+
+  // Requires b != 0
+  Element Div(Element a, Element b) const { return Mul(a, Inv(b)); }
+
+private:
+  BaseElement Low(Element a) const { return static_cast<BaseElement>(a & low_mask_); }
+  BaseElement High(Element a) const { return static_cast<BaseElement>(a >> k_); }
+  static BaseElement Sum(BaseElement a, BaseElement b) {
+    return static_cast<BaseElement>(a ^ b);
+  }
+  Element Pack(BaseElement high, BaseElement low) const {
+    return static_cast<Element>((Element{high} << k_) | low);
+  }
+
+  // The smallest L with absolute trace 1, which makes y^2 + y + L
+  // irreducible over the base
+  BaseElement FindLambda() const {
+    for (uint64_t value = 1; value <= low_mask_; ++value) {
+      const auto candidate = static_cast<BaseElement>(value);
+      BaseElement power = candidate;
+      BaseElement trace = candidate;
+      for (unsigned i = 1; i < k_; ++i) {
+        power = base_.Mul(power, power);
+        trace = Sum(trace, power);
+      }
+      if (trace == 1) return candidate;
+    }
+    throw std::logic_error("GF2mTower: no element of trace 1 in the base field");
+  }
+
+  Base base_;
+  unsigned k_;
+  Element low_mask_;
+  BaseElement lambda_ = 0;
+};
+
+using GF2mTower8 = GF2mLog<uint8_t>;
+using GF2mTower16 = GF2mTower<GF2mTower8>;
+using GF2mTower32 = GF2mTower<GF2mTower16>;
+
+// GF(2^8) in log/antilog form over the minimal-weight primitive modulus,
+// the ground level of every tower here
+inline GF2mTower8 MakeGF2mTower8() {
+  return GF2mTower8(8, static_cast<uint32_t>(FindPrimitiveModulus(8)));
+}
+
+inline GF2mTower16 MakeGF2mTower16() { return GF2mTower16(MakeGF2mTower8()); }
+
+inline GF2mTower32 MakeGF2mTower32() { return GF2mTower32(MakeGF2mTower16()); }
+
+} // namespace gfb
@@ -0,0 +1,326 @@
+/**
+ * @file gf2m_trace.hpp
+ * @brief Trace, half-trace and quadratic solving over GF(2^m)
+ *
+ * The absolute trace Tr(a) = a + a^2 + ... + a^(2^(m-1)) is 0 or 1, and
+ * z^2 + z = c has a solution exactly when Tr(c) = 0 (then z and z + 1).
+ * For odd m the half-trace H(c) = sum_(i = 0..(m-1)/2) c^(4^i) is one:
+ * H(c)^2 + H(c) = c + Tr(c).
+ *
+ * Two families of kernels:
+ *  - TraceArith computes them with the field's own arithmetic over the same
+ *    adapter interface as gfb::BatchArith: m - 1 squarings for the trace,
+ *    (m - 1)/2 double squarings for the half-trace, and for even m the
+ *    IEEE 1363-2000 A.4.7 iteration, with one extra multiplication per step
+ *    by a fixed element of trace 1. Any backend works; squarings are cheap
+ *    where the backend has its own Square (a rotation in a normal basis),
+ *    and a backend's own Trace or SolveQuadratic replaces the generic one
+ *    (popcount parity and a prefix XOR in a normal basis).
+ *  - GF2mTraceMap precomputes all three as GF(2)-linear maps of
+ *    polynomial-basis values, since squaring is linear: the trace is a bit
+ *    mask, and the half-trace and a solution of z^2 + z = c are m x m bit
+ *    matrices, applied either column by column (kMatrix) or eight bits at a
+ *    time through byte-indexed tables (kTable), as in gfb::GF2mBasisMap.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+//------------------------------------------------------------------------------
+// Field Arithmetic Kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Trace, half-trace and quadratic solving with a field's arithmetic
+ *
+ * @tparam Field A field adapter (Init, IsZero, Add, Mul, Order), optionally
+ *         with Square(r, a), Trace(r, a) and SolveQuadratic(z, c).
+ *
+ * The scratch elements keep the kernels from allocating for heap-backed
+ * elements (NTL), so an instance must not be shared across threads.
+ */
+template <typename Field> class TraceArith {
+public:
+  using Element = typename Field::Element;
+
+  // The field must outlive the object
+  explicit TraceArith(const Field &field)
+      : field_(field), m_(static_cast<unsigned>(std::countr_zero(field.Order()))) {
+    field_.Init(zero_, 0);
+    // Tr is a nonzero linear form, so some x^i has trace 1
+    Element candidate;
+    for (unsigned i = 0; i < m_; ++i) {
+      field_.Init(candidate, uint32_t{1} << i);
+      Trace(scratch_, candidate);
+      if (!field_.IsZero(scratch_)) {
+        tau_ = candidate;
+        return;
+      }
+    }
+    throw std::logic_error("TraceArith: no basis element of trace 1");
+  }
+
+  unsigned Degree() const { return m_; }
+
+  // r = Tr(a), the field's zero or one
+  void Trace(Element &r, const Element &a) const {
+    if constexpr (requires { field_.Trace(r, a); }) {
+      field_.Trace(r, a);
+      return;
+    }
+    r = a;
+    for (unsigned i = 1; i < m_; ++i) {
+      Square(r, r);
+      field_.Add(r, r, a);
+    }
+  }
+
+  // r = H(a). Requires odd m.
+  void HalfTrace(Element &r, const Element &a) const {
+    r = a;
+    for (unsigned i = 1; i <= (m_ - 1) / 2; ++i) {
+      Square(r, r);
+      Square(r, r);
+      field_.Add(r, r, a);
+    }
+  }
+
+  // z with z^2 + z = c; false, with z unspecified, when Tr(c) = 1. The other
+  // solution is z + 1.
+  bool SolveQuadratic(Element &z, const Element &c) const {
+    if constexpr (requires { field_.SolveQuadratic(z, c); }) {
+      return field_.SolveQuadratic(z, c);
+    }
+    if (m_ % 2 == 1) {
+      // H(c)^2 + H(c) + c = Tr(c)
+      HalfTrace(z, c);
+      Square(scratch_, z);
+      field_.Add(scratch_, scratch_, z);
+      field_.Add(scratch_, scratch_, c);
+      return field_.IsZero(scratch_);
+    }
+    // z_i = z_(i-1)^2 + w_(i-1)^2 tau, w_i = w_(i-1)^2 + c with z_0 = 0 and
+    // w_0 = c, ending at w_(m-1) = Tr(c)
+    z = zero_;
+    Element &w = scratch_;
+    w = c;
+    for (unsigned i = 1; i < m_; ++i) {
+      Square(z, z);
+      Square(w, w);
+      field_.Mul(product_, w, tau_);
+      field_.Add(z, z, product_);
+      field_.Add(w, w, c);
+    }
+    return field_.IsZero(w);
+  }
+
+private:
+  void Square(Element &r, const Element &a) const {
+    if constexpr (requires { field_.Square(r, a); }) {
+      field_.Square(r, a);
+    } else {
+      field_.Mul(r, a, a);
+    }
+  }
+
+  const Field &field_;
+  unsigned m_;
+  Element zero_;
+  Element tau_; // Tr(tau) = 1
+  mutable Element scratch_;
+  mutable Element product_;
+};
+
+//------------------------------------------------------------------------------
+// Precomputed Linear Maps
+//------------------------------------------------------------------------------
+
+enum class TraceMapForm { kMatrix, kTable };
+
+/**
+ * @brief Trace, half-trace and quadratic solving as precomputed GF(2)-linear
+ *        maps of polynomial-basis values
+ *
+ * @tparam Form How the half-trace and solver matrices are applied (see the
+ *         file comment); kMatrix also takes the trace as the parity of a
+ *         masked word, kTable as one bit per byte lookup.
+ *
+ * The solver map is built by Gauss-Jordan elimination on L(z) = z^2 + z,
+ * whose image is the trace-0 hyperplane: it sends every c of trace 0 to a
+ * preimage under L, for odd and even m alike.
+ */
+template <TraceMapForm Form = TraceMapForm::kTable> class GF2mTraceMap {
+public:
+  static constexpr TraceMapForm kForm = Form;
+
+  // `poly` is an irreducible modulus of degree m, given as a bitmask
+  // including x^m
+  GF2mTraceMap(uint8_t m, uint64_t poly)
+      : m_(m), poly_(poly), bytes_((m + 7u) / 8u) {
+    if (m < kMinModulusDegree || m > kMaxModulusDegree) {
+      throw std::invalid_argument("GF2mTraceMap: degree " + std::to_string(m) +
+                                  " out of range");
+    }
+    if (!IsIrreducibleModulus(m, poly)) {
+      throw std::invalid_argument("GF2mTraceMap: modulus is not irreducible");
+    }
+    BuildMaps();
+  }
+
+  uint8_t Degree() const { return m_; }
+  uint64_t Modulus() const { return poly_; }
+  // Bit i is Tr(x^i)
+  uint32_t TraceMask() const { return trace_mask_; }
+
+  size_t TableBytes() const {
+    return trace_table_.size() * sizeof(uint8_t) +
+           (half_trace_.size() + solve_.size()) * sizeof(uint32_t);
+  }
+
+  // Tr(a) as 0 or 1
+  uint32_t Trace(uint32_t a) const {
+    if constexpr (Form == TraceMapForm::kMatrix) {
+      return static_cast<uint32_t>(std::popcount(a & trace_mask_) & 1);
+    } else {
+      uint32_t r = 0;
+      for (unsigned k = 0; k < bytes_; ++k) {
+        r ^= trace_table_[k * 256 + ((a >> (8 * k)) & 0xFF)];
+      }
+      return r;
+    }
+  }
+
+  // H(a). Requires odd m.
+  uint32_t HalfTrace(uint32_t a) const { return Apply(half_trace_, a); }
+
+  // z with z^2 + z = c; false, with z unspecified, when Tr(c) = 1. The other
+  // solution is z + 1.
+  bool SolveQuadratic(uint32_t c, uint32_t &z) const {
+    z = Apply(solve_, c);
+    return Trace(c) == 0;
+  }
+
+private:
+  // kMatrix: column i of the map; kTable: one 256-entry table per byte
+  uint32_t Apply(const std::vector<uint32_t> &map, uint32_t a) const {
+    uint32_t r = 0;
+    if constexpr (Form == TraceMapForm::kMatrix) {
+      for (; a; a &= a - 1) r ^= map[static_cast<unsigned>(std::countr_zero(a))];
+    } else {
+      for (unsigned k = 0; k < bytes_; ++k) {
+        r ^= map[k * 256 + ((a >> (8 * k)) & 0xFF)];
+      }
+    }
+    return r;
+  }
+
+  uint32_t Square(uint32_t a) const {
+    return static_cast<uint32_t>(MulModModulus(a, a, m_, poly_));
+  }
+
+  void BuildMaps() {
+    const bool odd = m_ % 2 == 1;
+    std::vector<uint32_t> half_trace(odd ? m_ : 0, 0), solve(m_, 0);
+    for (unsigned i = 0; i < m_; ++i) {
+      const uint32_t basis = uint32_t{1} << i;
+      // Tr(x^i) lands on 0 or 1
+      uint32_t t = basis, power = basis;
+      for (unsigned j = 1; j < m_; ++j) {
+        power = Square(power);
+        t ^= power;
+      }
+      trace_mask_ |= (t & 1) << i;
+
+      if (odd) {
+        uint32_t h = basis;
+        power = basis;
+        for (unsigned j = 1; j <= (m_ - 1u) / 2; ++j) {
+          power = Square(Square(power));
+          h ^= power;
+        }
+        half_trace[i] = h;
+      }
+    }
+
+    // Gauss-Jordan on (L(x^i), x^i) pairs: afterwards each pivot pair holds
+    // (a value with a single pivot bit, its preimage). The one bit without a
+    // pivot, L having rank m - 1, maps to 0.
+    std::vector<std::pair<uint32_t, uint32_t>> pairs(m_);
+    for (unsigned i = 0; i < m_; ++i) {
+      const uint32_t basis = uint32_t{1} << i;
+      pairs[i] = {Square(basis) ^ basis, basis};
+    }
+    std::vector<unsigned> pivot_bits;
+    unsigned rank = 0;
+    for (unsigned bit = 0; bit < m_ && rank < m_; ++bit) {
+      unsigned pivot = rank;
+      while (pivot < m_ && ((pairs[pivot].first >> bit) & 1) == 0) ++pivot;
+      if (pivot == m_) continue;
+      std::swap(pairs[rank], pairs[pivot]);
+      for (unsigned i = 0; i < m_; ++i) {
+        if (i != rank && ((pairs[i].first >> bit) & 1)) {
+          pairs[i].first ^= pairs[rank].first;
+          pairs[i].second ^= pairs[rank].second;
+        }
+      }
+      pivot_bits.push_back(bit);
+      ++rank;
+    }
+    if (rank != m_ - 1u) {
+      throw std::logic_error("GF2mTraceMap: z^2 + z does not have rank m - 1");
+    }
+    for (unsigned r = 0; r < rank; ++r) solve[pivot_bits[r]] = pairs[r].second;
+
+    if constexpr (Form == TraceMapForm::kMatrix) {
+      half_trace_ = std::move(half_trace);
+      solve_ = std::move(solve);
+    } else {
+      half_trace_ = ByteTables(half_trace);
+      solve_ = ByteTables(solve);
+      trace_table_.assign(bytes_ * 256, 0);
+      for (unsigned k = 0; k < bytes_; ++k) {
+        for (unsigned v = 0; v < 256; ++v) {
+          trace_table_[k * 256 + v] = static_cast<uint8_t>(
+              std::popcount((v << (8 * k)) & trace_mask_) & 1);
+        }
+      }
+    }
+  }
+
+  // Byte-indexed tables of a map given by its m columns; none for no columns
+  std::vector<uint32_t> ByteTables(const std::vector<uint32_t> &columns) const {
+    if (columns.empty()) return {};
+    std::vector<uint32_t> tables(bytes_ * 256, 0);
+    for (unsigned k = 0; k < bytes_; ++k) {
+      // The top byte only spans the bits below m
+      const unsigned values = 1u << std::min(8u, m_ - 8 * k);
+      for (unsigned v = 1; v < values; ++v) {
+        const unsigned bit = 8 * k + static_cast<unsigned>(std::countr_zero(v));
+        tables[k * 256 + v] = tables[k * 256 + (v & (v - 1))] ^ columns[bit];
+      }
+    }
+    return tables;
+  }
+
+  uint8_t m_;
+  uint64_t poly_;
+  unsigned bytes_;
+  uint32_t trace_mask_ = 0;
+  std::vector<uint8_t> trace_table_;  // kTable: Tr of each byte value, per byte
+  std::vector<uint32_t> half_trace_;  // Odd m only
+  std::vector<uint32_t> solve_;
+};
+
+} // namespace gfb
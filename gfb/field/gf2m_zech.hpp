@@ -0,0 +1,241 @@
+/**
+ * @file gf2m_zech.hpp
+ * @brief Header-only GF(2^m) field in Zech-logarithm representation
+ *
+ * Nonzero elements are stored as their discrete logarithm to the primitive
+ * element x, encoded in [1, 2^m - 1] (x^0 = 1 is stored as 2^m - 1), and
+ * zero is stored as 0, matching the encoding used by Givaro::GFq. With that
+ * encoding multiplication, division and inversion are pure integer
+ * arithmetic, and addition needs a single Zech table lookup.
+ *
+ * Exponents are reduced with a sign-mask conditional add instead of `%` (see
+ * assembly/main.cpp), and zero operands are handled with selects, so the hot
+ * paths do not depend on well-predicted branches.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gf2m_modulus.hpp"
+
+namespace gfb {
+
+//------------------------------------------------------------------------------
+// GF2mZech
+//------------------------------------------------------------------------------
+
+// Zech table layouts. kFull stores Z(d) = log(1 + x^d) for every d. kHalf
+// stores only d <= (2^m - 1) / 2: Add swaps its operands when b - a falls
+// in the upper half, so it never needs the rest (Z(-d) = Z(d) - d), for a
+// few more ALU ops per Add.
+enum class ZechLayout { kFull, kHalf };
+
+/**
+ * @brief GF(2^m) in Zech-log representation with compact tables
+ *
+ * @tparam IndexT Table entry and element type. uint16_t is sufficient for
+ *         m <= 16 and halves the table footprint; uint32_t covers m <= 24.
+ * @tparam Layout Zech table layout; kHalf cuts the tables from 3 * 2^m to
+ *         2.5 * 2^m entries and the Add working set to 2^(m-1) entries.
+ *
+ * The tables are immutable once built and held through a shared owner, so
+ * copies share them, and they may live in memory the field does not
+ * allocate itself, e.g. a read-only file mapping (see gf2m_table_cache.hpp).
+ */
+template <typename IndexT, ZechLayout Layout = ZechLayout::kFull> class GF2mZech {
+public:
+  using Element = IndexT;
+  static constexpr ZechLayout kLayout = Layout;
+
+  static constexpr uint8_t kMaxDegree =
+      sizeof(IndexT) * 8 < 24 ? sizeof(IndexT) * 8 : 24;
+
+  // Builds the field for the primitive polynomial `poly`, given as a bitmask
+  // with bit i holding the coefficient of x^i (bit m must be set).
+  GF2mZech(uint8_t m, uint32_t poly) : m_(m), poly_(poly) {
+    if (m < 2 || m > kMaxDegree) {
+      throw std::invalid_argument("GF2mZech: degree " + std::to_string(m) +
+                                  " out of range for table entry type");
+    }
+    if (!IsPrimitiveModulus(m, poly)) {
+      throw std::invalid_argument("GF2mZech: modulus is not primitive");
+    }
+    order_ = 1u << m;
+    qm1_ = order_ - 1;
+    half_ = qm1_ / 2;
+    BuildTables();
+  }
+
+  // Builds the field for a minimal-weight primitive polynomial of degree m
+  explicit GF2mZech(uint8_t m)
+      : GF2mZech(m, static_cast<uint32_t>(FindPrimitiveModulus(m))) {}
+
+  // Adopts precomputed log and antilog tables of 2^m entries and a Zech
+  // table of ZechEntries(), laid out as BuildTables() writes them. `owner`
+  // keeps their memory alive for as long as any copy of the field exists.
+  // The tables are trusted; only the degree and modulus are checked.
+  GF2mZech(uint8_t m, uint32_t poly, const IndexT *log, const IndexT *antilog,
+           const IndexT *zech, std::shared_ptr<const void> owner)
+      : m_(m), poly_(poly), owner_(std::move(owner)), log_(log),
+        antilog_(antilog), zech_(zech) {
+    if (m < 2 || m > kMaxDegree || (poly >> m) != 1u) {
+      throw std::invalid_argument("GF2mZech: bad degree or modulus for tables");
+    }
+    order_ = 1u << m;
+    qm1_ = order_ - 1;
+    half_ = qm1_ / 2;
+  }
+
+  uint8_t Degree() const { return m_; }
+  uint32_t Order() const { return order_; }
+  uint32_t Modulus() const { return poly_; }
+
+  // Total bytes held by the log, antilog and Zech tables
+  size_t TableBytes() const {
+    return (2 * size_t{order_} + ZechEntries()) * sizeof(IndexT);
+  }
+
+  // Entries in the Zech table: Order(), or Order() / 2 for kHalf
+  size_t ZechEntries() const {
+    return Layout == ZechLayout::kFull ? order_ : size_t{half_} + 1;
+  }
+
+  // Raw log and antilog tables of Order() entries each and the Zech table
+  // of ZechEntries(), e.g. for serialization
+  const IndexT *LogTable() const { return log_; }
+  const IndexT *AntilogTable() const { return antilog_; }
+  const IndexT *ZechTable() const { return zech_; }
+
+  Element Zero() const { return 0; }
+  Element One() const { return static_cast<Element>(qm1_); }
+  bool IsZero(Element a) const { return a == 0; }
+
+  // Conversion between the polynomial (bit vector) and log representations
+  Element FromPolynomial(uint32_t value) const { return log_[value & qm1_]; }
+  uint32_t ToPolynomial(Element a) const { return antilog_[a]; }
+
+  Element Add(Element a, Element b) const {
+    // a + b = a * (1 + x^(b - a)); d lands in [0, 2^m - 1] for all inputs,
+    // including zeros, so the lookup is always in bounds.
+    uint32_t d = WrapNegative(static_cast<int32_t>(b) - a);
+    uint32_t base = a;
+    if constexpr (Layout == ZechLayout::kHalf) {
+      // Past the stored half, use a + b = b * (1 + x^(a - b)) instead. Masks
+      // rather than selects: the half is a coin flip on random operands.
+      const uint32_t upper = 0u - static_cast<uint32_t>(d > half_);
+      d ^= (d ^ (qm1_ - d)) & upper;
+      base ^= (base ^ b) & upper;
+    }
+    uint32_t z = zech_[d];
+    uint32_t s = ReduceExponent(base + z);
+    s = z == 0 ? 0 : s;
+    s = a == 0 ? b : s;
+    s = b == 0 ? a : s;
+    return static_cast<Element>(s);
+  }
+
+  // Characteristic 2: subtraction is addition and every element is its own
+  // negative
+  Element Sub(Element a, Element b) const { return Add(a, b); }
+  Element Neg(Element a) const { return a; }
+
+  Element Mul(Element a, Element b) const {
+    uint32_t s = ReduceExponent(static_cast<uint32_t>(a) + b);
+    return static_cast<Element>((a == 0 || b == 0) ? 0 : s);
+  }
+
+  // Requires b != 0
+  Element Div(Element a, Element b) const {
+    uint32_t s = WrapNegative(static_cast<int32_t>(a) - b - 1) + 1;
+    return static_cast<Element>(a == 0 ? 0 : s);
+  }
+
+  // Requires a != 0
+  Element Inv(Element a) const {
+    uint32_t s = qm1_ - a;
+    return static_cast<Element>(s == 0 ? qm1_ : s);
+  }
+
+  // a^e as one multiplication of the logarithm mod 2^m - 1; 0^0 = 1
+  Element Pow(Element a, uint64_t e) const {
+    if (a == 0) return e == 0 ? One() : 0;
+    uint64_t s = (uint64_t{a} % qm1_) * (e % qm1_) % qm1_;
+    return static_cast<Element>(s == 0 ? qm1_ : s);
+  }
+
+private:
+  // Adds 2^m - 1 to a negative v using its sign mask. Written this way
+  // rather than as `v < 0 ? v + q - 1 : v` because compilers may lower the
+  // ternary to a branch, which mispredicts half the time on random operands.
+  uint32_t WrapNegative(int32_t v) const {
+    return static_cast<uint32_t>(v + static_cast<int32_t>(qm1_ & (v >> 31)));
+  }
+
+  // Maps an exponent sum in [1, 2 * (2^m - 1)] back into [1, 2^m - 1]
+  uint32_t ReduceExponent(uint32_t e) const {
+    return WrapNegative(static_cast<int32_t>(e - qm1_ - 1)) + 1;
+  }
+
+  void BuildTables() {
+    // One allocation for all three tables, in log, antilog, Zech order
+    auto storage = std::make_shared<std::vector<IndexT>>(
+        2 * size_t{order_} + ZechEntries(), 0);
+    IndexT *log = storage->data();
+    IndexT *antilog = log + order_;
+    IndexT *zech = antilog + order_;
+
+    uint32_t x = 1;
+    for (uint32_t k = 0; k < qm1_; ++k) {
+      uint32_t encoded = k == 0 ? qm1_ : k;
+      antilog[encoded] = static_cast<IndexT>(x);
+      log[x] = static_cast<IndexT>(encoded);
+      x <<= 1;
+      if (x & order_) {
+        x ^= poly_;
+      }
+    }
+
+    // zech[d] = log(1 + x^d); d = 0 (and its alias 2^m - 1) maps to zero
+    const uint32_t zech_end = std::min<uint32_t>(qm1_, static_cast<uint32_t>(ZechEntries()));
+    for (uint32_t d = 1; d < zech_end; ++d) {
+      zech[d] = log[antilog[d] ^ 1u];
+    }
+
+    log_ = log;
+    antilog_ = antilog;
+    zech_ = zech;
+    owner_ = std::move(storage);
+  }
+
+  uint8_t m_;
+  uint32_t poly_;
+  uint32_t order_ = 0;
+  uint32_t qm1_ = 0;
+  uint32_t half_ = 0; // (2^m - 1) / 2, the last stored d in the half layout
+  std::shared_ptr<const void> owner_;
+  const IndexT *log_ = nullptr;     // polynomial -> encoded log
+  const IndexT *antilog_ = nullptr; // encoded log -> polynomial
+  const IndexT *zech_ = nullptr;    // exponent difference -> encoded log(1 + x^d)
+};
+
+// Invokes fn with a GF2mZech using the narrowest table entry type for m:
+// uint16_t up to GF(2^16), uint32_t above.
+template <typename Fn>
+decltype(auto) WithGF2mZech(uint8_t m, uint32_t poly, Fn &&fn) {
+  if (m <= 16) {
+    GF2mZech<uint16_t> field(m, poly);
+    return fn(static_cast<const GF2mZech<uint16_t> &>(field));
+  }
+  GF2mZech<uint32_t> field(m, poly);
+  return fn(static_cast<const GF2mZech<uint32_t> &>(field));
+}
+
+} // namespace gfb
@@ -0,0 +1,272 @@
+/**
+ * @file matrix_arith.hpp
+ * @brief Dense matrix kernels over a pluggable GF(2^m) field
+ *
+ * Matrices are packed row-major arrays (element (i, j) of an r x c matrix
+ * at i * c + j) over the same field adapter interface as gfb::ReedSolomon
+ * (see reed_solomon.hpp). Each O(n^3) kernel has a textbook variant and a
+ * cache-blocked one:
+ *  - Mul: the i-j-k dot-product loop, which walks B down its columns;
+ *  - MulBlocked: B is packed tile by tile into a contiguous block x block
+ *    buffer, and every row of A streams over the resident tile with unit
+ *    stride (c[i][j] += a[i][k] * b[k][j]);
+ *  - Invert: Gauss-Jordan on [A | I], every pivot sweeping all n rows of
+ *    width 2n, i.e. the whole working set per pivot;
+ *  - InvertBlocked: the same elimination a panel of `block` pivot columns
+ *    at a time. The panel is factored eagerly, and the rest of each row
+ *    gets the panel's combined update as one MulBlocked-style product, so
+ *    the working set is streamed once per panel instead of once per pivot.
+ *
+ * Singular inputs throw std::runtime_error, as in ReedSolomon.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gfb {
+
+template <typename Field> class MatrixArith {
+public:
+  using Element = typename Field::Element;
+
+  static constexpr size_t kDefaultBlock = 64;
+
+  // The field must outlive the object. `block` is the tile edge of the
+  // blocked kernels, in elements.
+  explicit MatrixArith(const Field &field, size_t block = kDefaultBlock)
+      : field_(field), block_(block) {
+    if (block == 0) {
+      throw std::invalid_argument("MatrixArith: block size must be positive");
+    }
+    field_.Init(zero_, 0);
+    field_.Init(one_, 1);
+  }
+
+  size_t Block() const { return block_; }
+
+  // y = A x for a rows x cols matrix A
+  void MulVec(Element *y, const Element *a, const Element *x, size_t rows,
+              size_t cols) const {
+    Element acc;
+    for (size_t i = 0; i < rows; ++i) {
+      const Element *row = a + i * cols;
+      acc = zero_;
+      for (size_t j = 0; j < cols; ++j) field_.MulAdd(acc, row[j], x[j]);
+      y[i] = acc;
+    }
+  }
+
+  // C = A B for n x k A and k x p B, as n * p dot products
+  void Mul(Element *c, const Element *a, const Element *b, size_t n, size_t k,
+           size_t p) const {
+    Element acc;
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < p; ++j) {
+        acc = zero_;
+        for (size_t x = 0; x < k; ++x) {
+          field_.MulAdd(acc, a[i * k + x], b[x * p + j]);
+        }
+        c[i * p + j] = acc;
+      }
+    }
+  }
+
+  // C = A B, tiled over packed blocks of B
+  void MulBlocked(Element *c, const Element *a, const Element *b, size_t n,
+                  size_t k, size_t p) const {
+    std::fill(c, c + n * p, zero_);
+    MulAddBlocked(c, p, a, k, b, p, n, k, p);
+  }
+
+  // Writes A^-1 for an n x n A
+  void Invert(Element *inv, const Element *a, size_t n) const {
+    std::vector<Element> m = Augment(a, n);
+    const size_t w = 2 * n;
+    Element scale, factor;
+    for (size_t col = 0; col < n; ++col) {
+      SwapPivotRow(m, nullptr, 0, n, col);
+      Element *pivot = &m[col * w];
+      field_.Inv(scale, pivot[col]);
+      // Columns left of col are already zero in the pivot row
+      for (size_t j = col; j < w; ++j) field_.Mul(pivot[j], pivot[j], scale);
+
+      // Characteristic 2: subtracting factor * pivot row is adding it
+      for (size_t r = 0; r < n; ++r) {
+        Element *row = &m[r * w];
+        if (r == col || field_.IsZero(row[col])) continue;
+        factor = row[col];
+        for (size_t j = col; j < w; ++j) field_.MulAdd(row[j], factor, pivot[j]);
+      }
+    }
+    ExtractInverse(inv, m, n);
+  }
+
+  // Writes A^-1 for an n x n A, one panel of Block() pivots at a time
+  void InvertBlocked(Element *inv, const Element *a, size_t n) const {
+    std::vector<Element> m = Augment(a, n);
+    const size_t w = 2 * n;
+    std::vector<Element> multipliers; // n x b: what each row owes the pivots
+    std::vector<Element> pivots;      // b x rest: final pivot rows
+    std::vector<Element> scales(block_);
+    Element factor;
+
+    for (size_t c0 = 0; c0 < n; c0 += block_) {
+      const size_t c1 = std::min(n, c0 + block_);
+      const size_t b = c1 - c0;
+      // Columns right of the panel receive the panel's update lazily; the
+      // ones left of it are unit vectors that row operations no longer touch
+      const size_t rest = w - c1;
+      multipliers.assign(n * b, zero_);
+
+      // Factor the panel columns eagerly, recording each elimination
+      for (size_t col = c0; col < c1; ++col) {
+        SwapPivotRow(m, &multipliers, b, n, col);
+        Element *pivot = &m[col * w];
+        Element &scale = scales[col - c0];
+        field_.Inv(scale, pivot[col]);
+        for (size_t j = col; j < c1; ++j) field_.Mul(pivot[j], pivot[j], scale);
+        for (size_t r = 0; r < n; ++r) {
+          Element *row = &m[r * w];
+          if (r == col || field_.IsZero(row[col])) continue;
+          factor = row[col];
+          multipliers[r * b + (col - c0)] = factor;
+          for (size_t j = col; j < c1; ++j) field_.MulAdd(row[j], factor, pivot[j]);
+        }
+      }
+
+      // Pivot row i as it stood when it was scaled: its own updates from
+      // earlier pivots in the panel, then the scale
+      pivots.resize(b * rest);
+      for (size_t i = 0; i < b; ++i) {
+        Element *out = &pivots[i * rest];
+        std::copy_n(&m[(c0 + i) * w + c1], rest, out);
+        for (size_t earlier = 0; earlier < i; ++earlier) {
+          const Element &f = multipliers[(c0 + i) * b + earlier];
+          if (field_.IsZero(f)) continue;
+          const Element *src = &pivots[earlier * rest];
+          for (size_t j = 0; j < rest; ++j) field_.MulAdd(out[j], f, src[j]);
+        }
+        for (size_t j = 0; j < rest; ++j) field_.Mul(out[j], out[j], scales[i]);
+      }
+
+      // Rows outside the panel: rest += multipliers * pivots
+      MulAddBlocked(&m[c1], w, multipliers.data(), b, pivots.data(), rest, c0,
+                    b, rest);
+      MulAddBlocked(&m[c1 * w + c1], w, &multipliers[c1 * b], b, pivots.data(),
+                    rest, n - c1, b, rest);
+
+      // Panel rows: eliminated only by the pivots that came after them
+      for (size_t i = 0; i < b; ++i) {
+        Element *row = &m[(c0 + i) * w + c1];
+        std::copy_n(&pivots[i * rest], rest, row);
+        for (size_t later = i + 1; later < b; ++later) {
+          const Element &f = multipliers[(c0 + i) * b + later];
+          if (field_.IsZero(f)) continue;
+          const Element *src = &pivots[later * rest];
+          for (size_t j = 0; j < rest; ++j) field_.MulAdd(row[j], f, src[j]);
+        }
+      }
+    }
+    ExtractInverse(inv, m, n);
+  }
+
+  // Rank of a rows x cols matrix, by Gaussian elimination on a copy
+  size_t Rank(const Element *a, size_t rows, size_t cols) const {
+    std::vector<Element> m(a, a + rows * cols);
+    size_t rank = 0;
+    Element scale, factor;
+    for (size_t col = 0; col < cols && rank < rows; ++col) {
+      size_t p = rank;
+      while (p < rows && field_.IsZero(m[p * cols + col])) p++;
+      if (p == rows) continue;
+      if (p != rank) {
+        std::swap_ranges(&m[p * cols], &m[p * cols] + cols, &m[rank * cols]);
+      }
+      Element *pivot = &m[rank * cols];
+      field_.Inv(scale, pivot[col]);
+      for (size_t j = col; j < cols; ++j) field_.Mul(pivot[j], pivot[j], scale);
+      for (size_t r = rank + 1; r < rows; ++r) {
+        Element *row = &m[r * cols];
+        if (field_.IsZero(row[col])) continue;
+        factor = row[col];
+        for (size_t j = col; j < cols; ++j) field_.MulAdd(row[j], factor, pivot[j]);
+      }
+      rank++;
+    }
+    return rank;
+  }
+
+private:
+  // C += A B for n x k A and k x p B with leading dimensions lda, ldb, ldc
+  void MulAddBlocked(Element *c, size_t ldc, const Element *a, size_t lda,
+                     const Element *b, size_t ldb, size_t n, size_t k,
+                     size_t p) const {
+    if (n == 0 || k == 0 || p == 0) return;
+    std::vector<Element> tile(block_ * block_);
+    for (size_t kk = 0; kk < k; kk += block_) {
+      const size_t kb = std::min(block_, k - kk);
+      for (size_t jj = 0; jj < p; jj += block_) {
+        const size_t jb = std::min(block_, p - jj);
+        for (size_t x = 0; x < kb; ++x) {
+          std::copy_n(b + (kk + x) * ldb + jj, jb, &tile[x * jb]);
+        }
+        for (size_t i = 0; i < n; ++i) {
+          Element *crow = c + i * ldc + jj;
+          const Element *arow = a + i * lda + kk;
+          for (size_t x = 0; x < kb; ++x) {
+            if (field_.IsZero(arow[x])) continue;
+            const Element *brow = &tile[x * jb];
+            for (size_t j = 0; j < jb; ++j) field_.MulAdd(crow[j], arow[x], brow[j]);
+          }
+        }
+      }
+    }
+  }
+
+  // [A | I] as an n x 2n packed matrix
+  std::vector<Element> Augment(const Element *a, size_t n) const {
+    std::vector<Element> m(n * 2 * n, zero_);
+    for (size_t r = 0; r < n; ++r) {
+      std::copy_n(a + r * n, n, &m[r * 2 * n]);
+      m[r * 2 * n + n + r] = one_;
+    }
+    return m;
+  }
+
+  // Moves the first row at or below `col` with a nonzero entry in column
+  // col into place, along with its row of `multipliers` (b per row) if any
+  void SwapPivotRow(std::vector<Element> &m, std::vector<Element> *multipliers,
+                    size_t b, size_t n, size_t col) const {
+    const size_t w = 2 * n;
+    size_t p = col;
+    while (p < n && field_.IsZero(m[p * w + col])) p++;
+    if (p == n) {
+      throw std::runtime_error("MatrixArith: singular matrix");
+    }
+    if (p == col) return;
+    std::swap_ranges(&m[p * w], &m[p * w] + w, &m[col * w]);
+    if (multipliers) {
+      std::swap_ranges(&(*multipliers)[p * b], &(*multipliers)[p * b] + b,
+                       &(*multipliers)[col * b]);
+    }
+  }
+
+  void ExtractInverse(Element *inv, const std::vector<Element> &m, size_t n) const {
+    for (size_t r = 0; r < n; ++r) {
+      std::copy_n(&m[r * 2 * n + n], n, inv + r * n);
+    }
+  }
+
+  const Field &field_;
+  size_t block_;
+  Element zero_;
+  Element one_;
+};
+
+} // namespace gfb
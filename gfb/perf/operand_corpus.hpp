@@ -0,0 +1,275 @@
+/**
+ * @file operand_corpus.hpp
+ * @brief Pre-generated, memory-mapped operand streams shared by every backend
+ *
+ * Benchmarks and simulations draw their operands as polynomial-basis values
+ * from mt19937(seed) through a uniform distribution over the nonzero
+ * elements, or over all of them. Drawing them separately per backend is
+ * slow for million-element streams (NTL built each element bit by bit), and
+ * nothing guarantees two backends actually see the same values. A corpus
+ * file holds one such stream, drawn once, and is mapped read-only by every
+ * consumer, which then converts it into its own representation in a single
+ * pass.
+ *
+ * Values are drawn sequentially, so the first n values of a longer stream
+ * are exactly the stream of length n; a file can serve any count up to its
+ * own, and is rewritten longer when a consumer needs more.
+ *
+ * Layout: an OperandCorpusHeader, zero padding up to kOperandCorpusAlignment,
+ * then `count` native-endian uint32_t values. Files are written to a
+ * temporary name and renamed into place, as in gf2m_table_cache.hpp. POSIX
+ * only (open/mmap).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gfb {
+
+constexpr char kOperandCorpusMagic[8] = {'G', 'F', 'B', 'O', 'P', 'N', 'D', '1'};
+constexpr uint32_t kOperandCorpusByteOrder = 0x01020304;
+constexpr uint32_t kOperandCorpusVersion = 1;
+constexpr size_t kOperandCorpusAlignment = 4096;
+// Smallest stream written to disk, so short requests share one file
+constexpr size_t kOperandCorpusMinCount = size_t{1} << 16;
+
+enum class OperandDistribution : uint32_t {
+  kNonzero = 1, // Uniform over [1, 2^m - 1]
+  kUniform = 2, // Uniform over [0, 2^m - 1]
+};
+
+struct OperandCorpusHeader {
+  char magic[8];
+  uint32_t byte_order; // kOperandCorpusByteOrder as written by the producer
+  uint32_t version;
+  uint32_t degree;
+  uint32_t distribution; // OperandDistribution
+  uint32_t seed;         // mt19937 seed
+  uint32_t value_bytes;  // sizeof(uint32_t)
+  uint64_t count;
+  uint64_t value_offset; // From the start of the file to the first value
+};
+
+// The draw itself: every corpus, on disk or on the heap, is this sequence
+class OperandStream {
+public:
+  OperandStream(uint8_t m, OperandDistribution distribution, uint32_t seed)
+      : gen_(seed),
+        dis_(distribution == OperandDistribution::kNonzero ? 1 : 0, MaxValue(m)) {}
+
+  uint32_t Next() { return dis_(gen_); }
+
+private:
+  static uint32_t MaxValue(uint8_t m) {
+    if (m < 1 || m > 32) {
+      throw std::invalid_argument("OperandStream: degree " + std::to_string(m) +
+                                  " out of range");
+    }
+    return static_cast<uint32_t>((uint64_t{1} << m) - 1);
+  }
+
+  std::mt19937 gen_;
+  std::uniform_int_distribution<uint32_t> dis_;
+};
+
+/**
+ * @brief A read-only stream of polynomial-basis operands for GF(2^m)
+ *
+ * Either a file mapping or a heap copy; copies share the storage, which
+ * lives as long as any of them.
+ */
+class OperandCorpus {
+public:
+  OperandCorpus() = default;
+
+  // Draws `count` values on the heap, without touching the disk
+  OperandCorpus(uint8_t m, OperandDistribution distribution, uint32_t seed,
+                size_t count)
+      : m_(m), distribution_(distribution), seed_(seed), count_(count) {
+    auto storage = std::make_shared<std::vector<uint32_t>>(count);
+    OperandStream stream(m, distribution, seed);
+    for (auto &value : *storage) value = stream.Next();
+    values_ = storage->data();
+    owner_ = std::move(storage);
+  }
+
+  uint8_t Degree() const { return m_; }
+  OperandDistribution Distribution() const { return distribution_; }
+  uint32_t Seed() const { return seed_; }
+  size_t size() const { return count_; }
+  const uint32_t *data() const { return values_; }
+  uint32_t operator[](size_t i) const { return values_[i]; }
+
+private:
+  friend OperandCorpus MapOperandCorpus(const std::string &path);
+
+  uint8_t m_ = 0;
+  OperandDistribution distribution_ = OperandDistribution::kNonzero;
+  uint32_t seed_ = 0;
+  size_t count_ = 0;
+  const uint32_t *values_ = nullptr;
+  std::shared_ptr<const void> owner_;
+};
+
+// Canonical corpus file name for a stream
+inline std::string OperandCorpusFileName(uint8_t m, OperandDistribution distribution,
+                                         uint32_t seed) {
+  char name[64];
+  std::snprintf(name, sizeof(name), "gfb_operands_m%u_%s_s%u.bin",
+                static_cast<unsigned>(m),
+                distribution == OperandDistribution::kNonzero ? "nonzero" : "uniform",
+                seed);
+  return name;
+}
+
+// Per-user scratch location shared by the benchmark and the simulations
+inline std::string DefaultOperandCorpusDirectory() {
+  return (std::filesystem::temp_directory_path() / "gfb_operand_corpus").string();
+}
+
+// Draws `count` values straight into `path`, replacing any existing file
+// atomically. Throws std::runtime_error on I/O failure.
+inline void SaveOperandCorpus(const std::string &path, uint8_t m,
+                              OperandDistribution distribution, uint32_t seed,
+                              size_t count) {
+  OperandCorpusHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kOperandCorpusMagic, sizeof(header.magic));
+  header.byte_order = kOperandCorpusByteOrder;
+  header.version = kOperandCorpusVersion;
+  header.degree = m;
+  header.distribution = static_cast<uint32_t>(distribution);
+  header.seed = seed;
+  header.value_bytes = sizeof(uint32_t);
+  header.count = count;
+  header.value_offset = kOperandCorpusAlignment;
+
+  const std::string temporary = path + ".tmp." + std::to_string(getpid());
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    const std::string padding(kOperandCorpusAlignment - sizeof(header), '\0');
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+    OperandStream stream(m, distribution, seed);
+    std::vector<uint32_t> chunk(std::min(count, kOperandCorpusMinCount));
+    for (size_t done = 0; done < count && out; done += chunk.size()) {
+      const size_t n = std::min(chunk.size(), count - done);
+      for (size_t i = 0; i < n; ++i) chunk[i] = stream.Next();
+      out.write(reinterpret_cast<const char *>(chunk.data()),
+                static_cast<std::streamsize>(n * sizeof(uint32_t)));
+    }
+    if (!out) {
+      std::remove(temporary.c_str());
+      throw std::runtime_error("SaveOperandCorpus: cannot write " + temporary);
+    }
+  }
+  if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+    std::remove(temporary.c_str());
+    throw std::runtime_error("SaveOperandCorpus: cannot rename to " + path);
+  }
+}
+
+// Maps a corpus file read-only. Throws std::runtime_error when the file is
+// missing, truncated or was written for another byte order or format
+// version.
+inline OperandCorpus MapOperandCorpus(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("MapOperandCorpus: cannot open " + path);
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(OperandCorpusHeader)) {
+    close(fd);
+    throw std::runtime_error("MapOperandCorpus: truncated header in " + path);
+  }
+  const size_t size = static_cast<size_t>(info.st_size);
+  void *base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); // The mapping keeps the file referenced
+  if (base == MAP_FAILED) {
+    throw std::runtime_error("MapOperandCorpus: cannot map " + path);
+  }
+  std::shared_ptr<const void> owner(
+      base, [size](const void *p) { munmap(const_cast<void *>(p), size); });
+
+  OperandCorpusHeader header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(header.magic, kOperandCorpusMagic, sizeof(header.magic)) != 0 ||
+      header.byte_order != kOperandCorpusByteOrder ||
+      header.version != kOperandCorpusVersion ||
+      header.value_bytes != sizeof(uint32_t) || header.degree < 1 ||
+      header.degree > 32 ||
+      (header.distribution != static_cast<uint32_t>(OperandDistribution::kNonzero) &&
+       header.distribution != static_cast<uint32_t>(OperandDistribution::kUniform))) {
+    throw std::runtime_error("MapOperandCorpus: incompatible corpus file " + path);
+  }
+  if (header.value_offset % alignof(uint32_t) != 0 ||
+      header.value_offset + header.count * sizeof(uint32_t) > size) {
+    throw std::runtime_error("MapOperandCorpus: truncated values in " + path);
+  }
+
+  OperandCorpus corpus;
+  corpus.m_ = static_cast<uint8_t>(header.degree);
+  corpus.distribution_ = static_cast<OperandDistribution>(header.distribution);
+  corpus.seed_ = header.seed;
+  corpus.count_ = static_cast<size_t>(header.count);
+  corpus.values_ = reinterpret_cast<const uint32_t *>(
+      static_cast<const char *>(base) + header.value_offset);
+  corpus.owner_ = std::move(owner);
+  return corpus;
+}
+
+// Returns at least `count` values of the stream for (m, distribution, seed),
+// mapped from the corpus in `directory`. A missing file, or one too short,
+// is (re)written first with at least kOperandCorpusMinCount values, rounded
+// up to a power of two so a growing sweep rewrites it only a few times. If
+// the directory cannot be written, the values are drawn on the heap.
+inline OperandCorpus OpenOperandCorpus(const std::string &directory, uint8_t m,
+                                       OperandDistribution distribution,
+                                       uint32_t seed, size_t count) {
+  const std::string path =
+      (std::filesystem::path(directory) /
+       OperandCorpusFileName(m, distribution, seed))
+          .string();
+  try {
+    OperandCorpus mapped = MapOperandCorpus(path);
+    if (mapped.Degree() == m && mapped.Distribution() == distribution &&
+        mapped.Seed() == seed && mapped.size() >= count) {
+      return mapped;
+    }
+  } catch (const std::runtime_error &) {
+    // Missing, stale or short: rewrite below
+  }
+
+  size_t file_count = kOperandCorpusMinCount;
+  while (file_count < count) file_count *= 2;
+  try {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    SaveOperandCorpus(path, m, distribution, seed, file_count);
+    return MapOperandCorpus(path);
+  } catch (const std::runtime_error &) {
+    return OperandCorpus(m, distribution, seed, count);
+  }
+}
+
+} // namespace gfb
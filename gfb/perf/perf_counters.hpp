@@ -0,0 +1,207 @@
+/**
+ * @file perf_counters.hpp
+ * @brief Per-thread hardware performance counters via perf_event_open
+ *
+ * Opens cycles, instructions, L1d read misses, LLC read misses, dTLB read
+ * misses and branch misses for the calling thread as one perf event group,
+ * so all events are scheduled onto the PMU together and their ratios (IPC,
+ * misses per op) come from the same instructions. Events the kernel or CPU
+ * does not offer are skipped individually; the group is unavailable only
+ * when none opens. Counts are scaled by time_enabled / time_running in case
+ * the group was multiplexed with other perf users.
+ *
+ * Only user-space events are counted, which keeps the group usable at the
+ * default perf_event_paranoid level of 2. On systems without
+ * perf_event_open (macOS, containers without a PMU) every group reports
+ * unavailable and callers fall back to wall-clock results alone.
+ */
+
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define GFB_PERF_LINUX 1
+#endif
+
+namespace gfb {
+
+enum class PerfEvent : int {
+  kCycles = 0,
+  kInstructions,
+  kL1dMisses,
+  kLLCMisses,
+  kDTLBMisses,
+  kBranchMisses
+};
+
+constexpr size_t kPerfEventCount = 6;
+
+const PerfEvent ALL_PERF_EVENTS[kPerfEventCount] = {
+    PerfEvent::kCycles,    PerfEvent::kInstructions, PerfEvent::kL1dMisses,
+    PerfEvent::kLLCMisses, PerfEvent::kDTLBMisses,   PerfEvent::kBranchMisses};
+
+inline const char *PerfEventName(PerfEvent event) {
+  switch (event) {
+    case PerfEvent::kCycles: return "Cycles";
+    case PerfEvent::kInstructions: return "Instructions";
+    case PerfEvent::kL1dMisses: return "L1dMisses";
+    case PerfEvent::kLLCMisses: return "LLCMisses";
+    case PerfEvent::kDTLBMisses: return "dTLBMisses";
+    case PerfEvent::kBranchMisses: return "BranchMisses";
+  }
+  return "unknown";
+}
+
+// Counter values from one Start/Stop interval; valid[i] is false for events
+// that could not be opened or were never scheduled
+struct PerfSample {
+  std::array<uint64_t, kPerfEventCount> values{};
+  std::array<bool, kPerfEventCount> valid{};
+
+  bool Has(PerfEvent event) const { return valid[static_cast<int>(event)]; }
+  uint64_t Get(PerfEvent event) const {
+    return values[static_cast<int>(event)];
+  }
+};
+
+/**
+ * @brief One perf event group bound to the constructing thread
+ *
+ * The counters follow the thread that opened them, so a group must be
+ * started, stopped and read on that thread. Not copyable; the file
+ * descriptors are closed on destruction.
+ */
+class PerfCounterGroup {
+public:
+  PerfCounterGroup() {
+    fds_.fill(-1);
+#if defined(GFB_PERF_LINUX)
+    for (PerfEvent event : ALL_PERF_EVENTS) {
+      Open(event);
+    }
+#else
+    error_ = "perf_event_open is Linux-only";
+#endif
+  }
+
+  ~PerfCounterGroup() {
+#if defined(GFB_PERF_LINUX)
+    for (int fd : fds_) {
+      if (fd >= 0) close(fd);
+    }
+#endif
+  }
+
+  PerfCounterGroup(const PerfCounterGroup &) = delete;
+  PerfCounterGroup &operator=(const PerfCounterGroup &) = delete;
+
+  bool Available() const { return leader_ >= 0; }
+  bool Has(PerfEvent event) const { return fds_[static_cast<int>(event)] >= 0; }
+
+  // Why the first event failed to open, empty when all opened
+  const std::string &Error() const { return error_; }
+
+  // Zeroes and enables every event in the group
+  void Start() {
+#if defined(GFB_PERF_LINUX)
+    if (!Available()) return;
+    ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  void Stop() {
+#if defined(GFB_PERF_LINUX)
+    if (!Available()) return;
+    ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  // Counts accumulated since the last Start
+  PerfSample Read() const {
+    PerfSample sample;
+#if defined(GFB_PERF_LINUX)
+    if (!Available()) return sample;
+
+    // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr]
+    std::array<uint64_t, 3 + kPerfEventCount> buffer{};
+    ssize_t bytes = read(leader_, buffer.data(), sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) return sample;
+    uint64_t enabled = buffer[1];
+    uint64_t running = buffer[2];
+    if (running == 0) return sample; // Never scheduled onto the PMU
+
+    double scale = static_cast<double>(enabled) / static_cast<double>(running);
+    size_t slot = 0;
+    for (PerfEvent event : ALL_PERF_EVENTS) {
+      int index = static_cast<int>(event);
+      if (fds_[index] < 0) continue;
+      sample.values[index] =
+          static_cast<uint64_t>(static_cast<double>(buffer[3 + slot]) * scale);
+      sample.valid[index] = true;
+      slot++;
+    }
+#endif
+    return sample;
+  }
+
+private:
+#if defined(GFB_PERF_LINUX)
+  static void Describe(PerfEvent event, perf_event_attr &attr) {
+    auto cache = [&attr](uint64_t id) {
+      attr.type = PERF_TYPE_HW_CACHE;
+      attr.config = id | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    attr.type = PERF_TYPE_HARDWARE;
+    switch (event) {
+      case PerfEvent::kCycles: attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+      case PerfEvent::kInstructions: attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+      case PerfEvent::kL1dMisses: cache(PERF_COUNT_HW_CACHE_L1D); break;
+      case PerfEvent::kLLCMisses: cache(PERF_COUNT_HW_CACHE_LL); break;
+      case PerfEvent::kDTLBMisses: cache(PERF_COUNT_HW_CACHE_DTLB); break;
+      case PerfEvent::kBranchMisses: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    }
+  }
+
+  void Open(PerfEvent event) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    Describe(event, attr);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // Only the leader starts disabled; members follow its enable state
+    attr.disabled = leader_ < 0;
+
+    int fd = static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+    if (fd < 0) {
+      if (error_.empty()) {
+        error_ = std::string(PerfEventName(event)) + ": " + std::strerror(errno);
+      }
+      return;
+    }
+    fds_[static_cast<int>(event)] = fd;
+    if (leader_ < 0) leader_ = fd;
+  }
+#endif
+
+  std::array<int, kPerfEventCount> fds_;
+  int leader_ = -1;
+  std::string error_;
+};
+
+} // namespace gfb
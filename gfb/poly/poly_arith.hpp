@@ -0,0 +1,357 @@
+/**
+ * @file poly_arith.hpp
+ * @brief Dense polynomial arithmetic over a pluggable GF(2^m) field
+ *
+ * Polynomials are coefficient vectors, lowest degree first, over the same
+ * field adapter interface as gfb::ReedSolomon (see reed_solomon.hpp). Each
+ * operation comes in the textbook variant and an asymptotically fast one,
+ * so callers (and the benchmarks) can pick either or let a size cutoff
+ * decide:
+ *  - multiplication: schoolbook, O(n^2), or Karatsuba, O(n^1.585), which
+ *    recurses down to the schoolbook below `karatsuba_cutoff` coefficients;
+ *  - division with remainder: long division, O((n - m) m), or Newton
+ *    iteration, which inverts the reversed divisor as a power series and
+ *    so costs a constant number of multiplications;
+ *  - GCD: Euclid's algorithm over either division.
+ *
+ * Characteristic 2 keeps the fast paths simple: subtraction is addition,
+ * and squaring is the linear map sum a_i x^i -> sum a_i^2 x^(2i), so each
+ * Newton step g <- g (2 - f g) reduces to g <- f g^2.
+ *
+ * Results are trimmed, so the zero polynomial is the empty vector and the
+ * last coefficient of any other result is nonzero.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gfb {
+
+enum class PolyMulAlgorithm { kSchoolbook, kKaratsuba };
+enum class PolyDivAlgorithm { kSchoolbook, kNewton };
+
+inline const char *PolyMulAlgorithmName(PolyMulAlgorithm algorithm) {
+  return algorithm == PolyMulAlgorithm::kSchoolbook ? "Schoolbook" : "Karatsuba";
+}
+
+inline const char *PolyDivAlgorithmName(PolyDivAlgorithm algorithm) {
+  return algorithm == PolyDivAlgorithm::kSchoolbook ? "Schoolbook" : "Newton";
+}
+
+template <typename Field> class PolyArith {
+public:
+  using Element = typename Field::Element;
+  using Poly = std::vector<Element>;
+
+  // The field must outlive the object. Multiplications where both operands
+  // have at least karatsuba_cutoff coefficients use Karatsuba, and
+  // divisions whose quotient has at least newton_cutoff coefficients use
+  // Newton iteration; 0 disables the fast variant. The defaults are the
+  // crossovers measured for the table backends over GF(2^16) (see
+  // BM_*_PolyMulCutoff and BM_*_PolyDivRem).
+  explicit PolyArith(const Field &field, size_t karatsuba_cutoff = 16,
+                     size_t newton_cutoff = 4096)
+      : field_(field), karatsuba_cutoff_(karatsuba_cutoff),
+        newton_cutoff_(newton_cutoff) {
+    field_.Init(zero_, 0);
+  }
+
+  size_t KaratsubaCutoff() const { return karatsuba_cutoff_; }
+  size_t NewtonCutoff() const { return newton_cutoff_; }
+
+  // Degree of a trimmed polynomial; -1 for zero
+  static long Degree(const Poly &a) { return static_cast<long>(a.size()) - 1; }
+
+  // Drops leading zero coefficients
+  void Trim(Poly &a) const {
+    while (!a.empty() && field_.IsZero(a.back())) a.pop_back();
+  }
+
+  void Add(Poly &r, const Poly &a, const Poly &b) const {
+    const Poly &longer = a.size() >= b.size() ? a : b;
+    const Poly &shorter = a.size() >= b.size() ? b : a;
+    Poly sum(longer);
+    for (size_t i = 0; i < shorter.size(); ++i) {
+      field_.Add(sum[i], sum[i], shorter[i]);
+    }
+    Trim(sum);
+    r = std::move(sum);
+  }
+
+  //----------------------------------------------------------------------------
+  // Multiplication
+  //----------------------------------------------------------------------------
+
+  void Mul(Poly &r, const Poly &a, const Poly &b) const {
+    const bool fast = karatsuba_cutoff_ != 0 &&
+                      std::min(a.size(), b.size()) >= karatsuba_cutoff_;
+    Mul(r, a, b, fast ? PolyMulAlgorithm::kKaratsuba : PolyMulAlgorithm::kSchoolbook);
+  }
+
+  void Mul(Poly &r, const Poly &a, const Poly &b, PolyMulAlgorithm algorithm) const {
+    if (a.empty() || b.empty()) {
+      r.clear();
+      return;
+    }
+    Poly product(a.size() + b.size() - 1, zero_);
+    if (algorithm == PolyMulAlgorithm::kSchoolbook) {
+      MulSchoolbook(product.data(), a.data(), a.size(), b.data(), b.size());
+    } else {
+      MulKaratsubaUnbalanced(product.data(), a.data(), a.size(), b.data(), b.size());
+    }
+    Trim(product);
+    r = std::move(product);
+  }
+
+  // a^2, by squaring each coefficient into the even positions
+  void Square(Poly &r, const Poly &a) const {
+    if (a.empty()) {
+      r.clear();
+      return;
+    }
+    Poly square(2 * a.size() - 1, zero_);
+    for (size_t i = 0; i < a.size(); ++i) {
+      field_.Mul(square[2 * i], a[i], a[i]);
+    }
+    r = std::move(square);
+  }
+
+  //----------------------------------------------------------------------------
+  // Division
+  //----------------------------------------------------------------------------
+
+  // a = q * b + r with deg r < deg b. Throws std::invalid_argument for b = 0.
+  void DivRem(Poly &q, Poly &r, const Poly &a, const Poly &b) const {
+    const bool fast = newton_cutoff_ != 0 && a.size() >= b.size() &&
+                      a.size() - b.size() + 1 >= newton_cutoff_;
+    DivRem(q, r, a, b, fast ? PolyDivAlgorithm::kNewton : PolyDivAlgorithm::kSchoolbook);
+  }
+
+  void DivRem(Poly &q, Poly &r, const Poly &a, const Poly &b,
+              PolyDivAlgorithm algorithm) const {
+    Poly divisor(b);
+    Trim(divisor);
+    if (divisor.empty()) {
+      throw std::invalid_argument("PolyArith: division by the zero polynomial");
+    }
+    Poly dividend(a);
+    Trim(dividend);
+    if (dividend.size() < divisor.size()) {
+      q.clear();
+      r = std::move(dividend);
+      return;
+    }
+    if (algorithm == PolyDivAlgorithm::kSchoolbook) {
+      DivRemSchoolbook(q, r, std::move(dividend), divisor);
+    } else {
+      DivRemNewton(q, r, dividend, divisor);
+    }
+  }
+
+  void Rem(Poly &r, const Poly &a, const Poly &b) const {
+    Poly q;
+    DivRem(q, r, a, b);
+  }
+
+  // f^-1 mod x^n for f(0) != 0, by Newton iteration. Throws
+  // std::invalid_argument when f(0) = 0.
+  void InvSeries(Poly &g, const Poly &f, size_t n) const {
+    if (f.empty() || field_.IsZero(f[0])) {
+      throw std::invalid_argument("PolyArith: series inverse needs f(0) != 0");
+    }
+    Poly inverse(1);
+    field_.Inv(inverse[0], f[0]);
+    Poly square;
+    for (size_t precision = 1; precision < n;) {
+      precision = std::min(2 * precision, n);
+      // g <- f g^2 mod x^precision
+      Square(square, inverse);
+      Poly truncated(f.begin(), f.begin() + std::min(f.size(), precision));
+      Truncate(square, precision);
+      Mul(inverse, truncated, square);
+      Truncate(inverse, precision);
+    }
+    Truncate(inverse, n);
+    g = std::move(inverse);
+  }
+
+  //----------------------------------------------------------------------------
+  // GCD
+  //----------------------------------------------------------------------------
+
+  // Monic gcd(a, b); zero when both are zero
+  void Gcd(Poly &g, const Poly &a, const Poly &b) const {
+    Gcd(g, a, b, PolyDivAlgorithm::kSchoolbook);
+  }
+
+  void Gcd(Poly &g, const Poly &a, const Poly &b, PolyDivAlgorithm algorithm) const {
+    Poly x(a);
+    Poly y(b);
+    Trim(x);
+    Trim(y);
+    Poly q, r;
+    while (!y.empty()) {
+      DivRem(q, r, x, y, algorithm);
+      x = std::move(y);
+      y = std::move(r);
+    }
+    MakeMonic(x);
+    g = std::move(x);
+  }
+
+  // Scales a nonzero polynomial so its leading coefficient is 1
+  void MakeMonic(Poly &a) const {
+    if (a.empty()) return;
+    Element scale;
+    field_.Inv(scale, a.back());
+    for (Element &c : a) field_.Mul(c, c, scale);
+  }
+
+private:
+  static void Truncate(Poly &a, size_t n) {
+    if (a.size() > n) a.resize(n);
+  }
+
+  // r[i + j] += a[i] * b[j]; r must hold na + nb - 1 coefficients
+  void MulSchoolbook(Element *r, const Element *a, size_t na, const Element *b,
+                     size_t nb) const {
+    for (size_t i = 0; i < na; ++i) {
+      if (field_.IsZero(a[i])) continue;
+      for (size_t j = 0; j < nb; ++j) {
+        field_.MulAdd(r[i + j], a[i], b[j]);
+      }
+    }
+  }
+
+  // r += a * b for operands of any lengths: the longer one is cut into
+  // blocks of the shorter one's length, each a balanced Karatsuba product
+  void MulKaratsubaUnbalanced(Element *r, const Element *a, size_t na,
+                              const Element *b, size_t nb) const {
+    if (na < nb) {
+      std::swap(a, b);
+      std::swap(na, nb);
+    }
+    std::vector<Element> scratch(KaratsubaScratch(nb), zero_);
+    std::vector<Element> block(2 * nb - 1, zero_);
+    std::vector<Element> padded(nb, zero_);
+    for (size_t start = 0; start < na; start += nb) {
+      const size_t len = std::min(nb, na - start);
+      const Element *chunk = a + start;
+      if (len < nb) {
+        std::copy_n(a + start, len, padded.begin());
+        chunk = padded.data();
+      }
+      std::fill(block.begin(), block.end(), zero_);
+      MulKaratsuba(block.data(), chunk, b, nb, scratch.data());
+      // Coefficients past na + nb - 1 are products of the zero padding
+      const size_t out = std::min(block.size(), na + nb - 1 - start);
+      for (size_t i = 0; i < out; ++i) {
+        field_.Add(r[start + i], r[start + i], block[i]);
+      }
+    }
+  }
+
+  // Scratch elements needed by MulKaratsuba for n-coefficient operands
+  size_t KaratsubaScratch(size_t n) const {
+    size_t total = 0;
+    while (n > std::max<size_t>(karatsuba_cutoff_, 1)) {
+      size_t hi = n - n / 2;
+      total += 4 * hi;
+      n = hi;
+    }
+    return total + 1;
+  }
+
+  // r = a * b for n-coefficient operands; r holds 2n - 1 zeroed coefficients
+  void MulKaratsuba(Element *r, const Element *a, const Element *b, size_t n,
+                    Element *scratch) const {
+    if (n <= std::max<size_t>(karatsuba_cutoff_, 1)) {
+      MulSchoolbook(r, a, n, b, n);
+      return;
+    }
+    const size_t lo = n / 2;
+    const size_t hi = n - lo;
+
+    // z0 = a0 b0 into r[0, 2lo - 1), z2 = a1 b1 into r[2lo, 2n - 1)
+    MulKaratsuba(r, a, b, lo, scratch);
+    MulKaratsuba(r + 2 * lo, a + lo, b + lo, hi, scratch);
+
+    // z1 = (a0 + a1)(b0 + b1) - z0 - z2, added at x^lo
+    Element *sa = scratch;
+    Element *sb = sa + hi;
+    Element *z1 = sb + hi;
+    Element *rest = z1 + 2 * hi;
+    for (size_t i = 0; i < hi; ++i) {
+      sa[i] = a[lo + i];
+      sb[i] = b[lo + i];
+      if (i < lo) {
+        field_.Add(sa[i], sa[i], a[i]);
+        field_.Add(sb[i], sb[i], b[i]);
+      }
+    }
+    std::fill(z1, z1 + 2 * hi - 1, zero_);
+    MulKaratsuba(z1, sa, sb, hi, rest);
+    for (size_t i = 0; i + 1 < 2 * lo; ++i) field_.Add(z1[i], z1[i], r[i]);
+    for (size_t i = 0; i + 1 < 2 * hi; ++i) field_.Add(z1[i], z1[i], r[2 * lo + i]);
+    for (size_t i = 0; i + 1 < 2 * hi; ++i) field_.Add(r[lo + i], r[lo + i], z1[i]);
+  }
+
+  void DivRemSchoolbook(Poly &q, Poly &r, Poly a, const Poly &b) const {
+    const size_t nb = b.size();
+    Poly quotient(a.size() - nb + 1, zero_);
+    Element lead_inv, factor;
+    field_.Inv(lead_inv, b.back());
+    for (size_t i = quotient.size(); i-- > 0;) {
+      Element &top = a[i + nb - 1];
+      if (field_.IsZero(top)) continue;
+      field_.Mul(factor, top, lead_inv);
+      quotient[i] = factor;
+      // Characteristic 2: subtracting factor * b is adding it
+      for (size_t j = 0; j < nb; ++j) {
+        field_.MulAdd(a[i + j], factor, b[j]);
+      }
+    }
+    a.resize(nb - 1);
+    Trim(a);
+    Trim(quotient);
+    q = std::move(quotient);
+    r = std::move(a);
+  }
+
+  // rev(q) = rev(a) * rev(b)^-1 mod x^(deg a - deg b + 1), then r = a - q b
+  void DivRemNewton(Poly &q, Poly &r, const Poly &a, const Poly &b) const {
+    const size_t k = a.size() - b.size() + 1;
+    Poly rev_b(b.rbegin(), b.rend());
+    Poly rev_a(a.rbegin(), a.rbegin() + std::min(a.size(), k));
+    Poly inverse;
+    InvSeries(inverse, rev_b, k);
+    Poly rev_q;
+    Mul(rev_q, rev_a, inverse);
+    rev_q.resize(k, zero_);
+    Poly quotient(rev_q.rbegin(), rev_q.rend());
+    Trim(quotient);
+
+    Poly product;
+    Mul(product, quotient, b);
+    Poly remainder(a.begin(), a.begin() + (b.size() - 1));
+    for (size_t i = 0; i < remainder.size() && i < product.size(); ++i) {
+      field_.Add(remainder[i], remainder[i], product[i]);
+    }
+    Trim(remainder);
+    q = std::move(quotient);
+    r = std::move(remainder);
+  }
+
+  const Field &field_;
+  size_t karatsuba_cutoff_;
+  size_t newton_cutoff_;
+  Element zero_;
+};
+
+} // namespace gfb